@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "resources/itemstore.hpp"
+#include "types/character.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+auto create_fighter() -> Character {
+
+	Character character{get_system(), get_resources()};
+	character.create_class_alignment(Enums::Character::Class::FIGHTER,
+									 Enums::Character::Align::GOOD);
+	character.finalise();
+	character.set_stage(Enums::Character::Stage::COMPLETED);
+
+	return character;
+}
+
+auto bm_character_create_random(benchmark::State &state) -> void {
+
+	for (auto _ : state) {
+		Character character{get_system(), get_resources()};
+		character.create_random();
+		benchmark::DoNotOptimize(character);
+	}
+}
+BENCHMARK(bm_character_create_random);
+
+// Includes copying the character, so that each level up starts from level 1
+auto bm_character_level_up(benchmark::State &state) -> void {
+
+	const auto fighter{create_fighter()};
+	for (auto _ : state) {
+		auto character{fighter};
+		character.level_up();
+		benchmark::DoNotOptimize(character);
+	}
+}
+BENCHMARK(bm_character_level_up);
+
+// Fill an inventory, equip it all, then empty it again
+auto bm_inventory(benchmark::State &state) -> void {
+
+	using enum Enums::Items::TypeID;
+
+	auto &items{*get_resources()->items};
+	const std::array types{LEATHER_ARMOR, LONG_SWORD, ROBES,
+						   DAGGER,		  STAFF,	  SHORT_SWORD};
+	Inventory inventory{};
+	for (auto _ : state) {
+		for (const auto type : types)
+			inventory.add_type(items[type], true);
+		for (auto slot = 1u; slot <= inventory.size(); slot++)
+			inventory.equip_item(slot);
+		inventory.unequip_all();
+		while (!inventory.is_empty())
+			inventory.discard_item(1);
+	}
+
+	state.SetItemsProcessed(state.iterations() * types.size());
+}
+BENCHMARK(bm_inventory);
+
+} // namespace
+
+}
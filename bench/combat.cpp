@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "engine/combat.hpp"
+#include "types/character.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+// Four full groups against a party of six fighters; each round starts from the
+// same fresh combat, so that every iteration does the same amount of work
+auto bm_combat_round(benchmark::State &state) -> void {
+
+	using enum Enums::Monsters::TypeID;
+
+	Combat combat{get_resources(), BENCH_SEED};
+	for (const auto type : {ORC, KOBOLD, ROGUE, ZOMBIE})
+		combat.add_group(type, 9);
+	for (auto i = 0; i < 6; i++) {
+		Character character{get_system(), get_resources()};
+		character.create_class_alignment(Enums::Character::Class::FIGHTER,
+										 Enums::Character::Align::GOOD);
+		character.finalise();
+		character.set_stage(Enums::Character::Stage::COMPLETED);
+		combat.add_character(character);
+	}
+	const std::array targets{0, 0, 1, 1, 2, 3};
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto round_combat{combat};
+		state.ResumeTiming();
+		benchmark::DoNotOptimize(round_combat.resolve_round(targets));
+	}
+}
+BENCHMARK(bm_combat_round)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+}
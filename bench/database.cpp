@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "resources/define.hpp"
+#include "types/character.hpp"
+#include "types/state.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+// A copy of the real database (for its tables) that is removed afterwards
+class TempDatabase {
+
+	public:
+		TempDatabase()
+			: path{std::filesystem::temp_directory_path() /
+				   std::format("sorcery_bench_{}.db3",
+							   std::chrono::system_clock::now()
+								   .time_since_epoch()
+								   .count())} {
+
+			std::error_code error{};
+			std::filesystem::copy_file(
+				(*get_system()->files)[DATABASE_FILE], path,
+				std::filesystem::copy_options::overwrite_existing, error);
+			if (!error) {
+				db = std::make_unique<Database>(path);
+				db->wipe_data();
+			}
+		}
+
+		~TempDatabase() {
+
+			db.reset();
+			std::error_code error{};
+			std::filesystem::remove(path, error);
+		}
+
+		TempDatabase(const TempDatabase &) = delete;
+		auto operator=(const TempDatabase &) -> TempDatabase & = delete;
+
+		std::filesystem::path path;
+		std::unique_ptr<Database> db;
+};
+
+auto to_xml(const auto &value) -> std::string {
+
+	std::stringstream ss;
+	{
+		cereal::XMLOutputArchive out_archive(ss);
+		out_archive(value);
+	}
+
+	return ss.str();
+}
+
+auto bm_database_game(benchmark::State &state) -> void {
+
+	TempDatabase temp{};
+	if (!temp.db || !temp.db->connected) {
+		state.SkipWithError("No database to copy");
+		return;
+	}
+
+	const auto data{to_xml(State{get_system()})};
+	const auto id{temp.db->create_game_state(data)};
+	const auto key{temp.db->load_game_state().value().key};
+	for (auto _ : state) {
+		temp.db->save_game_state(id, key, data);
+		benchmark::DoNotOptimize(temp.db->load_game_state());
+	}
+
+	state.SetBytesProcessed(state.iterations() * data.size() * 2);
+}
+BENCHMARK(bm_database_game);
+
+auto bm_database_character(benchmark::State &state) -> void {
+
+	TempDatabase temp{};
+	if (!temp.db || !temp.db->connected) {
+		state.SkipWithError("No database to copy");
+		return;
+	}
+
+	Character character{get_system(), get_resources()};
+	character.create_random();
+	character.finalise();
+	const auto data{to_xml(character)};
+	const auto id{temp.db->create_game_state(to_xml(State{get_system()}))};
+	const auto char_id{
+		temp.db->add_character(id, character.get_name(), data)};
+	for (auto _ : state) {
+		temp.db->update_character(id, char_id, character.get_name(), data);
+		benchmark::DoNotOptimize(temp.db->get_character(id, char_id));
+	}
+
+	state.SetBytesProcessed(state.iterations() * data.size() * 2);
+}
+BENCHMARK(bm_database_character);
+
+} // namespace
+
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "types/dice.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+auto bm_dice_parse(benchmark::State &state) -> void {
+
+	const std::string text{"3d8+2"};
+	for (auto _ : state) {
+		Dice dice{text};
+		benchmark::DoNotOptimize(dice);
+	}
+}
+BENCHMARK(bm_dice_parse);
+
+auto bm_dice_roll(benchmark::State &state) -> void {
+
+	const Dice dice{3, 8, 2};
+	for (auto _ : state)
+		benchmark::DoNotOptimize(dice.roll());
+}
+BENCHMARK(bm_dice_roll);
+
+auto bm_random_get(benchmark::State &state) -> void {
+
+	auto &random{*get_system()->random};
+	for (auto _ : state)
+		benchmark::DoNotOptimize(random[Enums::System::Random::D100]);
+}
+BENCHMARK(bm_random_get);
+
+} // namespace
+
+}
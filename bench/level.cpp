@@ -0,0 +1,106 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "common/macro.hpp"
+#include "resources/levelstore.hpp"
+#include "types/level.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+auto get_level() -> Level & {
+
+	static auto level{get_resources()->levels->get(-1).value()};
+
+	return level;
+}
+
+// Every tile on the level, in order
+auto bm_level_at(benchmark::State &state) -> void {
+
+	auto &level{get_level()};
+	const auto bottom_left{level.wrap_bottom_left()};
+	const auto top_right{level.wrap_top_right()};
+	for (auto _ : state)
+		for (auto y = bottom_left.y; y <= top_right.y; y++)
+			for (auto x = bottom_left.x; x <= top_right.x; x++)
+				benchmark::DoNotOptimize(&level.at(x, y));
+
+	state.SetItemsProcessed(state.iterations() *
+							(top_right.x - bottom_left.x + 1) *
+							(top_right.y - bottom_left.y + 1));
+}
+BENCHMARK(bm_level_at);
+
+// The tiles that the wireframe view looks up each frame, from every tile
+auto bm_level_at_directional(benchmark::State &state) -> void {
+
+	using Enums::Map::Direction;
+
+	auto &level{get_level()};
+	const auto bottom_left{level.wrap_bottom_left()};
+	const auto top_right{level.wrap_top_right()};
+	const auto facing{static_cast<Direction>(state.range(0))};
+	for (auto _ : state)
+		for (auto y = bottom_left.y; y <= top_right.y; y++)
+			for (auto x = bottom_left.x; x <= top_right.x; x++)
+				for (auto z = 0; z <= 3; z++)
+					for (auto dx = -1; dx <= 1; dx++)
+						benchmark::DoNotOptimize(&level.at(
+							Coordinate{x, y}, facing, dx, z));
+
+	state.SetItemsProcessed(state.iterations() * 12 *
+							(top_right.x - bottom_left.x + 1) *
+							(top_right.y - bottom_left.y + 1));
+}
+BENCHMARK(bm_level_at_directional)
+	->Arg(unenum(Enums::Map::Direction::NORTH))
+	->Arg(unenum(Enums::Map::Direction::EAST));
+
+auto bm_tile_walkable(benchmark::State &state) -> void {
+
+	using enum Enums::Map::Direction;
+
+	auto &level{get_level()};
+	const auto bottom_left{level.wrap_bottom_left()};
+	const auto top_right{level.wrap_top_right()};
+	for (auto _ : state)
+		for (auto y = bottom_left.y; y <= top_right.y; y++)
+			for (auto x = bottom_left.x; x <= top_right.x; x++) {
+				const auto &tile{level.at(x, y)};
+				benchmark::DoNotOptimize(tile.walkable(NORTH));
+				benchmark::DoNotOptimize(tile.walkable(SOUTH));
+				benchmark::DoNotOptimize(tile.walkable(EAST));
+				benchmark::DoNotOptimize(tile.walkable(WEST));
+			}
+
+	state.SetItemsProcessed(state.iterations() * 4 *
+							(top_right.x - bottom_left.x + 1) *
+							(top_right.y - bottom_left.y + 1));
+}
+BENCHMARK(bm_tile_walkable);
+
+} // namespace
+
+}
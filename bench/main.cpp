@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+
+auto Sorcery::Bench::get_system() -> System * {
+
+	static const auto system{[] {
+		auto system{std::make_unique<System>(0, nullptr)};
+		system->random->seed(BENCH_SEED);
+		return system;
+	}()};
+
+	return system.get();
+}
+
+auto Sorcery::Bench::get_resources() -> Resources * {
+
+	static const auto resources{std::make_unique<Resources>(get_system())};
+
+	return resources.get();
+}
+
+// Results also go to a JSON file (for comparing between releases) unless an
+// output file is given on the command line
+auto main(int argc, char *argv[]) -> int {
+
+	std::vector<char *> args(argv, argv + argc);
+	std::string out{std::format("--benchmark_out={}",
+								Sorcery::Bench::BENCH_JSON_FILE)};
+	std::string format{"--benchmark_out_format=json"};
+	if (std::ranges::none_of(args, [](std::string_view arg) {
+			return arg.starts_with("--benchmark_out=");
+		})) {
+		args.push_back(out.data());
+		args.push_back(format.data());
+	}
+
+	auto count{static_cast<int>(args.size())};
+	benchmark::Initialize(&count, args.data());
+	if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+		return EXIT_FAILURE;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "types/character.hpp"
+#include "types/state.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+// As saved to and loaded from the database
+template <class T> auto round_trip(const T &from, T &to) -> std::size_t {
+
+	std::stringstream ss;
+	{
+		cereal::XMLOutputArchive out_archive(ss);
+		out_archive(from);
+	}
+	const auto size{ss.str().size()};
+	{
+		cereal::XMLInputArchive in_archive(ss);
+		in_archive(to);
+	}
+
+	return size;
+}
+
+auto bm_state_xml(benchmark::State &state) -> void {
+
+	const State from{get_system()};
+	State to{get_system()};
+	std::size_t size{0};
+	for (auto _ : state)
+		size = round_trip(from, to);
+
+	state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(bm_state_xml);
+
+auto bm_character_xml(benchmark::State &state) -> void {
+
+	Character from{get_system(), get_resources()};
+	from.create_random();
+	from.finalise();
+	Character to{get_system(), get_resources()};
+	std::size_t size{0};
+	for (auto _ : state)
+		size = round_trip(from, to);
+
+	state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(bm_character_xml);
+
+} // namespace
+
+}
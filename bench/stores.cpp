@@ -0,0 +1,102 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "bench.hpp"
+#include "resources/componentstore.hpp"
+#include "resources/define.hpp"
+#include "resources/encountertable.hpp"
+#include "resources/loottable.hpp"
+#include "resources/stringstore.hpp"
+
+namespace Sorcery::Bench {
+
+namespace {
+
+// Every component on one screen, looked up by key as the UI does
+auto bm_component_store_get(benchmark::State &state) -> void {
+
+	ComponentStore components{(*get_system()->files)[LAYOUT_FILE]};
+	const auto screen{components("castle").value()};
+	std::vector<std::string> keys{};
+	for (const auto &component : screen)
+		keys.emplace_back(
+			std::format("{}:{}", component.form, component.name));
+
+	for (auto _ : state)
+		for (const auto &key : keys)
+			benchmark::DoNotOptimize(&components[key]);
+
+	state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(bm_component_store_get);
+
+// All the components of a screen at once
+auto bm_component_store_screen(benchmark::State &state) -> void {
+
+	ComponentStore components{(*get_system()->files)[LAYOUT_FILE]};
+	for (auto _ : state)
+		benchmark::DoNotOptimize(components("castle"));
+}
+BENCHMARK(bm_component_store_screen);
+
+auto bm_string_store_get(benchmark::State &state) -> void {
+
+	const auto &strings{*get_system()->strings};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&strings["WINDOW_TITLE"]);
+		benchmark::DoNotOptimize(strings.get("LEVEL_DING"));
+	}
+
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(bm_string_store_get);
+
+// A chest's worth of items at a time, on every treasure level
+auto bm_loot_table_draw(benchmark::State &state) -> void {
+
+	const auto &loot{*get_resources()->loot};
+	std::vector<Enums::Items::TypeID> types{};
+	for (auto _ : state)
+		for (auto level = 1u; level <= LOOT_LEVELS; level++) {
+			loot.draw(level, 8, types);
+			benchmark::DoNotOptimize(types.data());
+		}
+
+	state.SetItemsProcessed(state.iterations() * LOOT_LEVELS * 8);
+}
+BENCHMARK(bm_loot_table_draw);
+
+auto bm_encounter_table_draw(benchmark::State &state) -> void {
+
+	const auto &encounters{*get_resources()->encounters};
+	std::mt19937_64 random{BENCH_SEED};
+	for (auto _ : state)
+		for (auto depth = 1u; depth <= encounters.get_depths(); depth++)
+			benchmark::DoNotOptimize(encounters.draw(depth, random));
+
+	state.SetItemsProcessed(state.iterations() * encounters.get_depths());
+}
+BENCHMARK(bm_encounter_table_draw);
+
+} // namespace
+
+}
@@ -86,27 +86,37 @@ extern "C" {
 #include <array>
 #include <atomic>
 #include <bitset>
+#include <charconv>
 #include <chrono>
+#include <cmath>
 #include <codecvt>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
 #include <ctime>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <ios>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <locale>
 #include <memory>
 #include <mutex>
 #include <numbers>
+#include <optional>
 #include <print>
 #include <random>
 #include <ranges>
 #include <regex>
+#include <shared_mutex>
 #include <span>
 #include <sstream>
 #include <stdexcept>
@@ -115,6 +125,7 @@ extern "C" {
 #include <thread>
 #include <tuple>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <uuid/uuid.h>
 #include <variant>
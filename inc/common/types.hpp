@@ -297,6 +297,13 @@ struct GameEntry {
 		std::string data;
 };
 
+// What ImGui drew in the last frame (callbacks aren't counted as draw calls)
+struct DrawStats {
+		int vertices;
+		int indices;
+		int draw_calls;
+};
+
 struct ConsoleMessage {
 
 		long int id;
@@ -365,7 +372,7 @@ struct ShopStock {
 struct DungeonEvent {
 
 		Enums::Map::Event event;
-		std::string component_key;
+		std::string_view component_key;
 		bool search_after;
 		bool combat_after;
 		bool go_back_after;
@@ -376,7 +383,7 @@ struct DungeonEvent {
 
 		DungeonEvent() = default;
 
-		DungeonEvent(Enums::Map::Event event_, std::string component_key_,
+		DungeonEvent(Enums::Map::Event event_, std::string_view component_key_,
 					 bool search_after_, bool combat_after_,
 					 bool go_back_after_, bool go_town_after_)
 			: event{event_},
@@ -392,4 +399,149 @@ struct DungeonEvent {
 		}
 };
 
+// A fixed size map keyed by a small dense enum (or by an integer from 0 up to
+// Size - 1), stored as a flat array of key/value pairs so that it can be used
+// (and iterated over) in the same way as the std::map it replaces
+template <typename Key, typename Value,
+		  std::size_t Size = magic_enum::enum_count<Key>()>
+class EnumMap {
+
+	public:
+		using value_type = std::pair<Key, Value>;
+		using iterator = typename std::array<value_type, Size>::iterator;
+		using const_iterator =
+			typename std::array<value_type, Size>::const_iterator;
+
+		EnumMap() {
+
+			clear();
+		}
+
+		EnumMap(std::initializer_list<value_type> values) {
+
+			*this = values;
+		}
+
+		auto operator=(std::initializer_list<value_type> values) -> EnumMap & {
+
+			clear();
+			for (const auto &[key, value] : values)
+				(*this)[key] = value;
+
+			return *this;
+		}
+
+		auto operator[](const Key key) -> Value & {
+
+			return _data[_index(key)].second;
+		}
+
+		auto operator[](const Key key) const -> const Value & {
+
+			return _data[_index(key)].second;
+		}
+
+		auto operator==(const EnumMap &other) const -> bool = default;
+
+		auto at(const Key key) -> Value & {
+
+			return _data.at(_index(key)).second;
+		}
+
+		auto at(const Key key) const -> const Value & {
+
+			return _data.at(_index(key)).second;
+		}
+
+		auto contains(const Key key) const -> bool {
+
+			return _index(key) < Size;
+		}
+
+		auto clear() -> void {
+
+			for (auto i = 0u; i < Size; i++)
+				_data[i] = value_type{_key(i), Value{}};
+		}
+
+		auto size() const -> std::size_t {
+
+			return Size;
+		}
+
+		auto begin() -> iterator {
+
+			return _data.begin();
+		}
+
+		auto end() -> iterator {
+
+			return _data.end();
+		}
+
+		auto begin() const -> const_iterator {
+
+			return _data.begin();
+		}
+
+		auto end() const -> const_iterator {
+
+			return _data.end();
+		}
+
+		// Serialised in the same form as a std::map so older saves still load
+		template <class Archive> auto save(Archive &archive) const -> void {
+
+			archive(cereal::make_size_tag(static_cast<cereal::size_type>(Size)));
+			for (const auto &[key, value] : _data)
+				archive(cereal::make_map_item(key, value));
+		}
+
+		template <class Archive> auto load(Archive &archive) -> void {
+
+			cereal::size_type size{0};
+			archive(cereal::make_size_tag(size));
+			clear();
+			for (auto i = 0u; i < size; i++) {
+				Key key{};
+				Value value{};
+				archive(cereal::make_map_item(key, value));
+				if (contains(key))
+					(*this)[key] = value;
+			}
+		}
+
+	private:
+		static constexpr auto _index(const Key key) -> std::size_t {
+
+			if constexpr (std::is_enum_v<Key>)
+				return static_cast<std::size_t>(
+					unenum(key) - unenum(magic_enum::enum_values<Key>()[0]));
+			else
+				return static_cast<std::size_t>(key);
+		}
+
+		static constexpr auto _key(const std::size_t index) -> Key {
+
+			if constexpr (std::is_enum_v<Key>)
+				return magic_enum::enum_values<Key>()[index];
+			else
+				return static_cast<Key>(index);
+		}
+
+		std::array<value_type, Size> _data;
+};
+
+// Transparent hash so unordered containers keyed by std::string can be
+// searched with a std::string_view without building a temporary
+struct StringHash {
+
+		using is_transparent = void;
+
+		auto operator()(std::string_view value) const -> std::size_t {
+
+			return std::hash<std::string_view>{}(value);
+		}
+};
+
 };
\ No newline at end of file
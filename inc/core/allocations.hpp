@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+// Number and total size of heap allocations
+struct AllocationCount {
+		std::uint64_t count;
+		std::uint64_t bytes;
+};
+
+// Counts heap allocations by replacing the global operator new. This is opt in
+// (configure with -DSORCERY_TRACK_ALLOCATIONS=ON) and otherwise all the counts
+// stay at zero; the profiler and trace use it to show allocations per frame
+// and per scope, and a frame budget can be set to fail automated runs
+class Allocations {
+
+	public:
+		// Public Methods
+		static auto is_tracking() -> bool;
+		static auto get_total() -> AllocationCount;
+		static auto get_thread() -> AllocationCount;
+		static auto set_budget(std::string_view value) -> bool;
+		static auto check_frame(std::string_view screen) -> void;
+};
+
+}
@@ -61,6 +61,7 @@ class Application {
 	private:
 		// Private Methods
 		auto _add_quickstart_party() -> void;
+		auto _add_random_roster(const int count) -> void;
 		auto _check_param(std::string_view param) const -> bool;
 		auto _get_exe_path() const -> std::string_view;
 		auto _load_existing_game() -> void;
@@ -69,9 +70,19 @@ class Application {
 		auto _do_start_expedition(const int mode) -> int;
 		auto _do_restart_expedition(const int mode) -> int;
 		auto _do_town() -> int;
+		auto _do_headless() -> int;
+		auto _render_screen(const std::string &screen, const int frames)
+			-> bool;
+		auto _setup_replay() -> void;
+		auto _run_headless_command(const std::string &command)
+			-> std::optional<int>;
 
 		// Private Members
 		std::vector<std::string> _args;
+		std::filesystem::path _script;
+		std::filesystem::path _record;
+		std::filesystem::path _replay;
+		bool _in_maze;
 		std::unique_ptr<System> _system;
 		std::unique_ptr<Resources> _resources;
 		std::unique_ptr<Display> _display;
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "common/include.hpp"
+#include "core/flag.hpp"
 
 namespace Sorcery {
 
@@ -66,17 +67,16 @@ class Controller {
 		auto set(std::string_view value) -> void;
 		auto set_game(Game *game) -> void;
 		auto get() const -> std::string_view;
-		auto move_screen(const std::string &from_screen,
-						 const std::string &to_screen) -> void;
+		auto move_screen(const Flag from_screen, const Flag to_screen) -> void;
 		auto clear_character(const std::string &flag) -> void;
 		auto get_character(const std::string &flag) const -> int;
 		auto has_character(const std::string &flag) const -> bool;
 		auto set_character(const std::string &flag, const int value) -> void;
-		auto get_flag(const std::string &flag) const -> bool;
-		auto get_flag_ref(const std::string &flag) -> bool &;
-		auto set_flag(const std::string &flag) -> void;
-		auto unset_flag(const std::string &flag) -> void;
-		auto has_flag(const std::string &flag) const -> bool;
+		auto get_flag(const Flag flag) const -> bool;
+		auto get_flag_ref(const Flag flag) -> bool &;
+		auto set_flag(const Flag flag) -> void;
+		auto unset_flag(const Flag flag) -> void;
+		auto has_flag(const Flag flag) const -> bool;
 		auto get_flags() const -> std::string;
 		auto get_characters() const -> std::string;
 		auto has_text(const std::string &flag) const -> bool;
@@ -92,6 +92,7 @@ class Controller {
 		int destination; // Where to go next
 		bool busy; // Currently busy (e.g. loading an asset or saving a game)
 		std::string last; // Last screen redrawn by the ui
+		bool show_profiler; // Show the frame profiler overlay
 
 		// In-Dungeon Flags
 		Enums::Map::Event last_event;	// Last event in dungeon
@@ -113,7 +114,7 @@ class Controller {
 		Game *_game;
 		bool _has_save;
 		std::map<std::string, int> _characters;	   // Character Selections
-		std::map<std::string, bool> _flags;		   // Logic Flags
+		std::array<bool, FLAG_COUNT> _flags;	   // Logic Flags
 		std::map<std::string, std::string> _texts; // "Global" Texts
 };
 
@@ -35,11 +35,45 @@ inline constexpr auto ICONS_TILE_ROW_COUNT{15u};
 inline constexpr auto ITEM_TILE_ROW_COUNT{15u};
 inline constexpr auto MAP_TILE_ROW_COUNT{10u};
 
+// Textured Dungeon View (the texture sheet is cut into square layers, with
+// the first few reserved and the rest used for walls by tile texture id)
+inline constexpr auto TEXTURED_VIEW_KEY{"textured_view"sv};
+inline constexpr auto DUNGEON_TEXTURE_SIZE{128};
+inline constexpr auto DUNGEON_FLOOR_LAYER{0u};
+inline constexpr auto DUNGEON_CEILING_LAYER{1u};
+inline constexpr auto DUNGEON_DOOR_LAYER{2u};
+inline constexpr auto DUNGEON_VIEW_FOV{60.0f};
+inline constexpr auto DUNGEON_VIEW_DISTANCE{5.0f};
+inline constexpr auto DUNGEON_VIEW_DISTANCE_DARK{1.5f};
+
+// Profiler (samples are shared between all threads)
+inline constexpr auto PROFILE_FRAME_COUNT{240u};
+inline constexpr auto PROFILE_SAMPLE_COUNT{16384u};
+
+// Trace (per thread limits on recorded spans)
+inline constexpr auto TRACE_RESERVE_EVENTS{4096u};
+inline constexpr auto TRACE_MAX_EVENTS{1048576u};
+
 // Command Line Parameters
 inline constexpr auto CONTINUE_GAME_PARAM{"--continue"sv};
 inline constexpr auto NEW_GAME_PARAM{"--new"sv};
 inline constexpr auto QUICKSTART_PARAM{"--quickstart"sv};
 inline constexpr auto GO_TO_MAZE_PARAM{"--go-to-maze"sv};
+inline constexpr auto TRACE_PARAM{"--trace="sv};
+inline constexpr auto ALLOCATION_BUDGET_PARAM{"--alloc-budget="sv};
+inline constexpr auto HEADLESS_PARAM{"--headless"sv};
+inline constexpr auto SCRIPT_PARAM{"--script="sv};
+inline constexpr auto RECORD_PARAM{"--record="sv};
+inline constexpr auto REPLAY_PARAM{"--replay="sv};
+inline constexpr auto REPLAY_TIMED_PARAM{"--replay-timed"sv};
+
+// Input Recordings
+inline constexpr std::array<char, 8> REPLAY_MAGIC{'S', 'O', 'R', 'C',
+												  'R', 'E', 'P', 'L'};
+inline constexpr auto REPLAY_VERSION{2u};
+
+// Headless Mode (frames drawn by a script "render" without a count)
+inline constexpr auto HEADLESS_RENDER_FRAMES{60};
 
 // Window Data
 #define WINDOW_LAYER_BG "##layer_bg"
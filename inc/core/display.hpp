@@ -33,21 +33,26 @@ class Size;
 class Display {
 
 	public:
-		explicit Display(System *system);
+		explicit Display(System *system, const bool headless = false);
 
 		auto get_SDL_window() -> SDL_Window *;
 		auto get_SDL_window_size() -> Size;
 		auto get_GL_context() -> SDL_GLContext;
 		auto get_GLSL_version() const -> const char *;
+		auto has_GL() const -> bool;
+		auto is_headless() const -> bool;
 
 	private:
 		auto initialise_SDL() -> int;
+		auto _create_window() -> bool;
 
 		System *_system;
 		SDL_Window *_SDL_window;
 		SDL_GLContext _GL_context;
 		std::string _GLSL_version;
 		SDL_WindowFlags _SDL_window_flags;
+		bool _headless;
+		bool _has_GL;
 };
 
 }
\ No newline at end of file
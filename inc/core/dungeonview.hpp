@@ -0,0 +1,118 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "types/level.hpp"
+
+namespace Sorcery {
+
+// Forward Declarations
+class System;
+
+// Optional perspective view of the maze, drawn with the wall textures in an
+// array texture. The geometry for each level is built once on a worker thread
+// the first time the party arrives there and then kept on the GPU, so drawing
+// a frame is a single static draw call from inside ImGui's render pass
+class DungeonView {
+
+	public:
+		// Constructors
+		DungeonView(System *system, const char *glsl_version);
+		DungeonView() = delete;
+
+		// Destructor
+		~DungeonView();
+
+		DungeonView(const DungeonView &) = delete;
+		auto operator=(const DungeonView &) -> DungeonView & = delete;
+
+		// Public Methods
+		auto is_available() -> bool;
+		auto prepare(const Level &level) -> void;
+		auto is_ready(const int depth) -> bool;
+		auto submit(ImDrawList *draw_list, const int depth,
+					const Coordinate loc,
+					const Enums::Map::Direction facing, const ImVec2 pos,
+					const ImVec2 size, const float fade, const bool monochrome,
+					const bool lit) -> void;
+
+	private:
+		// Vertex layout in the buffer (position in maze units, with x east, y
+		// up and z south, plus texture coordinates and array layer)
+		struct ViewVertex {
+				float x;
+				float y;
+				float z;
+				float u;
+				float v;
+				float layer;
+				float shade;
+		};
+
+		// A level's geometry once uploaded
+		struct LevelMesh {
+				GLuint vao;
+				GLuint vbo;
+				GLsizei count;
+		};
+
+		// Private Methods
+		static auto _build(Level level, const unsigned int layers)
+			-> std::vector<ViewVertex>;
+		static auto _callback(const ImDrawList *draw_list, const ImDrawCmd *cmd)
+			-> void;
+		auto _init() -> bool;
+		auto _load_textures() -> bool;
+		auto _compile(const GLenum type, std::string_view source) -> GLuint;
+		auto _upload(const std::vector<ViewVertex> &vertices) -> LevelMesh;
+		auto _render() -> void;
+
+		// Private Members
+		System *_system;
+		std::string _glsl_version;
+		std::optional<bool> _available;
+		GLuint _program;
+		GLuint _texture;
+		unsigned int _layers;
+		GLint _u_view;
+		GLint _u_projection;
+		GLint _u_fade;
+		GLint _u_monochrome;
+		GLint _u_distance;
+		GLint _u_texture;
+		std::map<int, std::future<std::vector<ViewVertex>>> _pending;
+		std::map<int, LevelMesh> _meshes;
+
+		// Frame state, used when the callback runs
+		std::array<float, 16> _view;
+		std::array<float, 16> _projection;
+		std::array<GLint, 4> _viewport;
+		GLsizei _count;
+		GLuint _vao;
+		float _fade;
+		float _distance;
+		bool _monochrome;
+};
+
+}
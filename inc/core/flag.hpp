@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+using namespace std::literals;
+
+// Every logic flag the Controller knows about - the position in this table is
+// the flag's id, and the name is only used for debugging output
+inline constexpr std::array FLAG_NAMES{
+	"after_tile_message"sv,
+	"heal_finished"sv,
+	"napping_finished"sv,
+	"party_order_changed"sv,
+	"recuperating_finished"sv,
+	"select_next_character"sv,
+	"select_previous_character"sv,
+	"show_add"sv,
+	"show_atlas"sv,
+	"show_bestiary"sv,
+	"show_castle"sv,
+	"show_choose"sv,
+	"show_compendium"sv,
+	"show_edge_of_town"sv,
+	"show_engine"sv,
+	"show_heal"sv,
+	"show_inn"sv,
+	"show_inspect"sv,
+	"show_levelup"sv,
+	"show_license"sv,
+	"show_main_menu"sv,
+	"show_museum"sv,
+	"show_nolevelup"sv,
+	"show_options"sv,
+	"show_pay"sv,
+	"show_recovery"sv,
+	"show_remove"sv,
+	"show_reorder"sv,
+	"show_restart"sv,
+	"show_results"sv,
+	"show_roster"sv,
+	"show_shop"sv,
+	"show_spellbook"sv,
+	"show_stay"sv,
+	"show_tavern"sv,
+	"show_temple"sv,
+	"show_title"sv,
+	"show_training_grounds"sv,
+	"want_abort"sv,
+	"want_cannot_donate"sv,
+	"want_continue_game"sv,
+	"want_divvy_gold"sv,
+	"want_donate"sv,
+	"want_donated_ok"sv,
+	"want_drop"sv,
+	"want_enter_maze"sv,
+	"want_exit_game"sv,
+	"want_gold"sv,
+	"want_help"sv,
+	"want_identify"sv,
+	"want_inspect"sv,
+	"want_invoke"sv,
+	"want_leave_game"sv,
+	"want_new_game"sv,
+	"want_not_enough_gold"sv,
+	"want_pool_gold"sv,
+	"want_quit_expedition"sv,
+	"want_restart_expedition"sv,
+	"want_stay"sv,
+	"want_take_stairs_down"sv,
+	"want_take_stairs_up"sv,
+	"want_tithe"sv,
+	"want_trade"sv,
+	"want_use"sv};
+
+inline constexpr auto FLAG_COUNT{FLAG_NAMES.size()};
+
+// A flag id, resolved from its name at compile time (so an unknown or mistyped
+// flag name is a compile error, and checking a flag is just an array index)
+class Flag {
+
+	public:
+		consteval Flag(const char *name)
+			: id{_find(name)} {};
+
+		unsigned int id;
+
+		constexpr auto name() const -> std::string_view {
+
+			return FLAG_NAMES[id];
+		}
+
+	private:
+		static consteval auto _find(std::string_view name) -> unsigned int {
+
+			for (auto i = 0u; i < FLAG_COUNT; i++)
+				if (FLAG_NAMES[i] == name)
+					return i;
+
+			throw std::invalid_argument("Unknown controller flag");
+		}
+};
+
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "core/allocations.hpp"
+#include "core/define.hpp"
+
+namespace Sorcery {
+
+// A timed span, with its nesting depth on the thread that recorded it and the
+// allocations made within it (if tracked)
+struct ProfileSample {
+		const char *name;
+		std::int64_t start;
+		std::int64_t end;
+		std::uint32_t depth;
+		AllocationCount allocations;
+};
+
+// Collects timing samples into a fixed ring buffer, marked off into frames.
+// Recording claims a slot with an atomic increment and then publishes it with
+// the slot's sequence number, so scopes can be used from any thread without
+// locking; the overlay reads back the last finished frame on the main thread,
+// skipping any slot that is not (or is no longer) the sample it expects
+class Profiler {
+
+	public:
+		// Constructors
+		Profiler(const Profiler &) = delete;
+		auto operator=(const Profiler &) -> Profiler & = delete;
+
+		// Public Methods
+		static auto get() -> Profiler &;
+		static auto now() -> std::int64_t;
+		auto next_frame() -> void;
+		auto record(const char *name, const std::int64_t start,
+					const std::int64_t end, const std::uint32_t depth,
+					const AllocationCount allocations) -> void;
+		auto get_last_frame(std::vector<ProfileSample> &samples) const
+			-> std::pair<std::int64_t, std::int64_t>;
+		auto get_last_allocations() const -> AllocationCount;
+		auto get_frame_times() const -> std::vector<float>;
+		auto get_percentiles() const -> std::array<float, 3>;
+
+	private:
+		// A finished frame, as a time range and a range of sample numbers,
+		// with the allocations made on all threads during it
+		struct ProfileFrame {
+				std::int64_t start;
+				std::int64_t end;
+				std::uint64_t first;
+				std::uint64_t last;
+				AllocationCount allocations;
+		};
+
+		// One sample in the ring buffer. Every field is atomic as the slot may
+		// be written on one thread while it is read on another; sequence is
+		// the sample's number plus one once written, and zero while it is
+		struct ProfileSlot {
+				std::atomic<std::uint64_t> sequence;
+				std::atomic<const char *> name;
+				std::atomic<std::int64_t> start;
+				std::atomic<std::int64_t> end;
+				std::atomic<std::uint32_t> depth;
+				std::atomic<std::uint64_t> count;
+				std::atomic<std::uint64_t> bytes;
+		};
+
+		// Constructors
+		Profiler();
+
+		// Private Members
+		std::array<ProfileSlot, PROFILE_SAMPLE_COUNT> _samples;
+		std::array<ProfileFrame, PROFILE_FRAME_COUNT> _frames;
+		std::atomic<std::uint64_t> _head;
+		std::uint64_t _frame_count;
+		std::int64_t _frame_start;
+		std::uint64_t _frame_first;
+		AllocationCount _frame_allocations;
+};
+
+// Times the enclosing block; use PROFILE_SCOPE rather than this directly
+class ProfileScope {
+
+	public:
+		// Constructors
+		explicit ProfileScope(const char *name);
+		ProfileScope() = delete;
+
+		// Destructor
+		~ProfileScope();
+
+		ProfileScope(const ProfileScope &) = delete;
+		auto operator=(const ProfileScope &) -> ProfileScope & = delete;
+
+	private:
+		// Private Members
+		const char *_name;
+		std::int64_t _start;
+		std::uint32_t _depth;
+		AllocationCount _allocations;
+};
+
+}
+
+// Profiling is compiled out entirely in release builds
+#ifdef NDEBUG
+#define PROFILE_SCOPE(name)
+#define PROFILE_FRAME()
+#else
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name)                                                    \
+	const Sorcery::ProfileScope PROFILE_CONCAT(_profile_scope_, __LINE__) {    \
+		name                                                                   \
+	}
+#define PROFILE_FRAME() Sorcery::Profiler::get().next_frame()
+#endif
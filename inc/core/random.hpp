@@ -38,10 +38,14 @@ class Random {
 		auto get_type(const int num) const -> Enums::System::Random;
 		auto get(const unsigned int min, const unsigned int max)
 			-> unsigned int;
+		auto get_bits() -> std::uint64_t;
+		auto get_seed() const -> std::uint64_t;
+		auto seed(const std::uint64_t value) -> void;
 
 	private:
 		std::random_device _device;
 		std::mt19937_64 _random;
+		std::uint64_t _seed;
 		std::map<Enums::System::Random, std::tuple<unsigned int, unsigned int>>
 			_range;
 		std::vector<std::string> _sy1;
@@ -23,7 +23,9 @@
 #pragma once
 
 #include "common/include.hpp"
+#include "core/dungeonview.hpp"
 #include "core/types.hpp"
+#include "core/wireframe.hpp"
 #include "types/tile.hpp"
 
 // Class to handles rendering Wireframe
@@ -49,6 +51,7 @@ class Render {
 		auto get_monochrome() const -> bool;
 		auto set_monochrome(bool value) -> void;
 		auto draw(Game *game, Component *component) -> void;
+		auto prepare(const Level &level) -> void;
 
 	private:
 		// Private Members
@@ -56,6 +59,9 @@ class Render {
 		Display *_display;
 		UI *_ui;
 		Controller *_controller;
+		Wireframe _wireframe;
+		DungeonView _dungeon_view;
+		bool _use_wireframe;
 		bool _loaded;
 		unsigned int _depth;
 		unsigned int _width;
@@ -78,7 +84,10 @@ class Render {
 			-> bool;
 		auto _has_wall(const Tile &tile,
 					   const Enums::Map::Direction direction) const -> bool;
+		auto _get_view_pos(const Component *component, const float scale) const
+			-> ImVec2;
 		auto _load_tile_views() -> void;
+		auto _render_textured(Game *game, Component *component) -> void;
 		auto _render_wireframe(Game *game, Component *component) -> void;
 		auto _set_texture_coordinates(TileView &tileview) -> void;
 		auto _set_vertex_array(VertexArray &array, ImVec2 p1, ImVec2 p2,
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "core/define.hpp"
+
+namespace Sorcery {
+
+// An input event as recorded, with the frame and time (in microseconds since
+// recording started) that it arrived
+struct ReplayEvent {
+		std::uint64_t frame;
+		std::int64_t time;
+		SDL_Event event;
+};
+
+// Start of a recording; the event size guards against a different SDL build
+struct ReplayHeader {
+		std::array<char, 8> magic;
+		std::uint32_t version;
+		std::uint32_t event_size;
+		std::uint64_t seed;
+};
+
+// Records input (and the RNG seed) with --record=<file>, and plays it back in
+// place of real input with --replay=<file>, as fast as frames can be drawn or
+// with --replay-timed at the pace it was recorded. Events are stored as is, so
+// a recording is only good for the same build and game data. The scheduler
+// clock is also stored for every frame (as an event of type SDL_FIRSTEVENT,
+// which SDL never sends), so that timers fire on the same frames when played
+// back; the game quits once a recording has been played to the end
+class Replay {
+
+	public:
+		// Constructors
+		Replay(const Replay &) = delete;
+		auto operator=(const Replay &) -> Replay & = delete;
+
+		// Public Methods
+		static auto get() -> Replay &;
+		auto record(const std::filesystem::path &path, const std::uint64_t seed)
+			-> bool;
+		auto replay(const std::filesystem::path &path, const bool timed)
+			-> std::optional<std::uint64_t>;
+		auto poll(SDL_Event *event) -> bool;
+		auto next_frame() -> void;
+		auto get_ticks() const -> std::uint64_t;
+		auto stop() -> void;
+
+	private:
+		enum class Mode {
+			NONE,
+			RECORD,
+			REPLAY
+		};
+
+		// Constructors
+		Replay();
+
+		// Private Methods
+		auto _now() const -> std::int64_t;
+		auto _is_recordable(const SDL_Event &event) const -> bool;
+		auto _write_ticks() -> void;
+
+		// Private Members
+		Mode _mode;
+		bool _timed;
+		std::uint64_t _frame;
+		std::chrono::steady_clock::time_point _epoch;
+		std::ofstream _file;
+		std::vector<ReplayEvent> _events;
+		std::vector<std::uint64_t> _frame_ticks;
+		std::uint64_t _ticks;
+		std::size_t _next;
+		bool _finished;
+};
+
+}
@@ -24,8 +24,10 @@
 
 #include "common/include.hpp"
 #include "core/include.hpp"
+#include "resources/encountertable.hpp"
 #include "resources/itemstore.hpp"
 #include "resources/levelstore.hpp"
+#include "resources/loottable.hpp"
 #include "resources/monsterstore.hpp"
 #include "resources/spellstore.hpp"
 
@@ -42,6 +44,8 @@ class Resources {
 		std::unique_ptr<LevelStore> levels;
 		std::unique_ptr<MonsterStore> monsters;
 		std::unique_ptr<SpellStore> spells;
+		std::unique_ptr<LootTable> loot;
+		std::unique_ptr<EncounterTable> encounters;
 
 	private:
 		System *_system;
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+// Timers that fire on the main thread when the scheduler is updated each
+// frame, instead of on SDL's timer thread. Callbacks have the same contract
+// as SDL_AddTimer: return the next interval in milliseconds, or 0 to stop
+class Scheduler {
+
+	public:
+		Scheduler();
+
+		auto add(const Uint32 interval, SDL_TimerCallback callback,
+				 void *param) -> SDL_TimerID;
+		auto remove(const SDL_TimerID id) -> bool;
+		auto update() -> void;
+
+	private:
+		struct Timer {
+				SDL_TimerCallback callback;
+				void *param;
+				Uint32 interval;
+		};
+
+		// Each live timer has exactly one entry in the heap; entries are left
+		// behind when a timer is removed and skipped when they come due (ids
+		// are never reused)
+		struct Deadline {
+				Uint64 when;
+				SDL_TimerID id;
+
+				auto operator>(const Deadline &other) const -> bool {
+					return when > other.when;
+				}
+		};
+
+		std::vector<Deadline> _deadlines;
+		std::unordered_map<SDL_TimerID, Timer> _timers;
+		SDL_TimerID _next_id;
+
+		auto _push(const SDL_TimerID id, const Uint64 when) -> void;
+};
+
+}
@@ -27,6 +27,7 @@
 #include "core/database.hpp"
 #include "core/include.hpp"
 #include "core/random.hpp"
+#include "core/scheduler.hpp"
 #include "resources/filestore.hpp"
 #include "resources/stringstore.hpp"
 #include "types/config.hpp"
@@ -51,9 +52,11 @@ class System {
 		std::unique_ptr<FileStore> files;
 		std::unique_ptr<StringStore> strings;
 		std::unique_ptr<Random> random;
+		std::unique_ptr<Scheduler> scheduler;
 
 	private:
 		std::unique_ptr<CSimpleIniA> _settings;
+		std::unique_ptr<Random> _animation_random;
 };
 
 }
\ No newline at end of file
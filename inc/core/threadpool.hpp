@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+// A fixed set of worker threads for splitting work by index. Each worker has
+// its own queue of index ranges and works from the back of it; once that is
+// empty it steals from the front of the other queues, so uneven jobs still
+// keep every worker busy
+class ThreadPool {
+
+	public:
+		// Constructors (zero threads means one per core)
+		explicit ThreadPool(const unsigned int threads = 0);
+
+		// Destructor
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool &) = delete;
+		auto operator=(const ThreadPool &) -> ThreadPool & = delete;
+
+		// Public Methods
+		auto size() const -> unsigned int;
+		auto parallel_for(
+			const std::size_t count, const std::size_t chunk,
+			const std::function<void(std::size_t, unsigned int)> &job) -> void;
+
+	private:
+		// A range of indexes [first, last)
+		struct Range {
+				std::size_t first;
+				std::size_t last;
+		};
+
+		struct Queue {
+				std::mutex mutex;
+				std::deque<Range> ranges;
+		};
+
+		// Private Methods
+		auto _work(const unsigned int worker) -> void;
+		auto _pop(const unsigned int worker) -> std::optional<Range>;
+
+		// Private Members
+		std::vector<std::unique_ptr<Queue>> _queues;
+		const std::function<void(std::size_t, unsigned int)> *_job;
+		std::mutex _mutex;
+		std::condition_variable _wake;
+		std::condition_variable _done;
+		std::uint64_t _generation;
+		std::size_t _remaining;
+		bool _stop;
+		std::vector<std::jthread> _workers;
+};
+
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "core/allocations.hpp"
+#include "core/define.hpp"
+
+namespace Sorcery {
+
+// A finished span on one thread (times in microseconds since tracing started)
+// and the allocations made on that thread within it (if tracked)
+struct TraceEvent {
+		const char *name;
+		std::int64_t start;
+		std::int64_t duration;
+		AllocationCount allocations;
+};
+
+// Records timing spans from any thread into per-thread buffers and writes them
+// out as a Chrome trace event file (viewable in Perfetto or chrome://tracing)
+// when the game exits. Does nothing unless started with --trace=<file>
+class Trace {
+
+	public:
+		// Constructors
+		Trace(const Trace &) = delete;
+		auto operator=(const Trace &) -> Trace & = delete;
+
+		// Public Methods
+		static auto get() -> Trace &;
+		auto start(const std::filesystem::path &path) -> void;
+		auto stop() -> void;
+		auto is_enabled() const -> bool;
+		auto now() const -> std::int64_t;
+		auto add(const char *name, const std::int64_t start,
+				 const std::int64_t end, const AllocationCount allocations)
+			-> void;
+		auto set_thread_name(std::string_view name) -> void;
+
+	private:
+		// Locked by its own thread for every event (so never contended) and
+		// by the trace when written, as a thread can still be running then
+		struct TraceBuffer {
+				std::mutex mutex;
+				std::uint32_t id;
+				std::string name;
+				std::vector<TraceEvent> events;
+		};
+
+		// Constructors
+		Trace();
+
+		// Private Methods
+		auto _get_buffer() -> TraceBuffer &;
+		auto _write() -> bool;
+
+		// Private Members
+		std::atomic<bool> _enabled;
+		std::chrono::steady_clock::time_point _epoch;
+		std::filesystem::path _path;
+		std::mutex _mutex;
+		std::vector<std::unique_ptr<TraceBuffer>> _buffers;
+};
+
+// Times the enclosing block when tracing; use TRACE_SCOPE rather than this
+class TraceScope {
+
+	public:
+		// Constructors
+		explicit TraceScope(const char *name);
+		TraceScope() = delete;
+
+		// Destructor
+		~TraceScope();
+
+		TraceScope(const TraceScope &) = delete;
+		auto operator=(const TraceScope &) -> TraceScope & = delete;
+
+	private:
+		// Private Members
+		const char *_name;
+		std::int64_t _start;
+		AllocationCount _allocations;
+};
+
+}
+
+// Unlike profiling, tracing stays in release builds so that users can send us
+// a trace of a problem; when not tracing, a scope costs one atomic load
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name)                                                      \
+	const Sorcery::TraceScope TRACE_CONCAT(_trace_scope_, __LINE__) {          \
+		name                                                                   \
+	}
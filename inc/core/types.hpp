@@ -73,6 +73,7 @@ struct Vertex {
 struct VertexArray {
 
 		std::array<Vertex, 4> data;
+		int quad{-1}; // Position in the Wireframe vertex buffer, if any
 
 		VertexArray() = default;
 
@@ -25,6 +25,7 @@
 #include "common/include.hpp"
 #include "common/types.hpp"
 #include "core/macro.hpp"
+#include "gui/textcache.hpp"
 #include "resources/imagestore.hpp"
 #include "types/component.hpp"
 #include "types/enum.hpp"
@@ -41,9 +42,11 @@ class ComponentStore;
 class Controller;
 class Dialog;
 class Display;
+class DungeonView;
 class Frame;
 class Game;
 class Input;
+class Level;
 class Message;
 class Menu;
 class Modal;
@@ -51,6 +54,8 @@ class Render;
 class Resources;
 class Popup;
 class System;
+class Wireframe;
+struct ProfileSample;
 struct VertexArray;
 
 class UI {
@@ -77,6 +82,12 @@ class UI {
 						const ImVec2 p_min, const ImVec2 p_sz) -> void;
 		auto draw_view_image(std::string_view source, const VertexArray &array)
 			-> void;
+		auto draw_view_wireframe(Wireframe *wireframe, const float fade,
+								 const bool monochrome) -> void;
+		auto draw_view_textured(DungeonView *dungeon_view, Game *game,
+								const ImVec2 pos, const ImVec2 size,
+								const float fade, const bool monochrome)
+			-> void;
 		auto draw_menu(const std::string name, const ImColor sel_colour,
 					   const ImVec2 pos, const ImVec2 sz,
 					   const Enums::Layout::Font font,
@@ -85,7 +96,11 @@ class UI {
 		auto draw_text(const std::string string, const ImColor colour,
 					   const ImVec2 pos, const Enums::Layout::Font font)
 			-> void;
+		auto get_draw_stats() const -> DrawStats;
 		auto get_hl_colour(const double percent) const -> ImColor;
+		auto get_screens() const -> std::vector<std::string>;
+		auto has_screen(const std::string &screen) const -> bool;
+		auto is_module(const std::string &screen) const -> bool;
 		auto lerp_colour(const ImVec4 col_from, const ImVec4 col_yo,
 						 const double percent) const -> ImVec4;
 		auto io() -> ImGuiIO &;
@@ -101,7 +116,8 @@ class UI {
 							  std::vector<std::string> &items,
 							  const bool reorder) -> void;
 		auto load_message(const Enums::Map::Event event)
-			-> std::vector<std::string>;
+			-> std::span<const std::string_view>;
+		auto prepare_view(const Level &level) -> void;
 		auto set_monochrome(const bool value) -> void;
 		auto start() -> void;
 		auto stop() -> void;
@@ -147,6 +163,7 @@ class UI {
 		std::map<std::string, bool> pressed;
 		std::array<bool, 21> ms_selected;
 		std::array<bool, 29> ps_selected;
+		TextCache text_cache;
 
 	private:
 		// Private Members
@@ -156,11 +173,13 @@ class UI {
 		Controller *_controller;
 		ImGuiIO _io;
 		std::unique_ptr<Render> _render;
+		unsigned int _icons_image;
 		std::vector<std::shared_ptr<Frame>> _frames;
 		std::vector<std::shared_ptr<Menu>> _menus;
 		std::vector<unsigned int> _attract_data;
 		std::map<std::string, std::function<void(Game *)>> _draw_modules;
 		std::map<std::string, std::function<void()>> _draw_frontend;
+		std::vector<ProfileSample> _profile_samples;
 
 		// Private Methods
 		auto _display_add(Game *game) -> void;
@@ -201,19 +220,20 @@ class UI {
 		auto _draw_button_click(Component *component, bool &is_clicked,
 								const bool reverse = false) -> void;
 		auto _draw_character_summary(Component *component, Game *game,
-									 Character *character) -> void;
+									 const Character *character) -> void;
 		auto _draw_character_detailed(Component *component, Game *game,
-									  Character *character) -> void;
+									  const Character *character) -> void;
 		auto _draw_character_detailed_again(Component *component, Game *game,
-											Character *character) -> void;
+											const Character *character) -> void;
 		auto _draw_character_mage_spells(Component *component, Game *game,
-										 Character *character) -> void;
+										 const Character *character) -> void;
 		auto _draw_character_priest_spells(Component *component, Game *game,
-										   Character *character) -> void;
+										   const Character *character) -> void;
 		auto _draw_choose(Game *game, const int mode) -> void;
 		auto _draw_compass(Game *game) -> void;
 		auto _draw_components(std::string_view screen, Game *game = nullptr,
 							  const int mode = -1) -> void;
+		auto _draw_console(Game *game) -> void;
 		auto _draw_current_character(Game *game, const int mode) -> void;
 		auto _draw_cursor() -> void;
 		auto _draw_fg_image(Component *component) -> void;
@@ -258,6 +278,7 @@ class UI {
 		auto _setup_draw_modules() -> void;
 
 		auto _draw_debug() -> void;
+		auto _draw_profiler() -> void;
 };
 
 };
@@ -0,0 +1,106 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "core/types.hpp"
+
+namespace Sorcery {
+
+class Image;
+
+// Draws the dungeon view with OpenGL in a single call: every quad of every
+// tile view lives in one static vertex buffer, and each frame only the list
+// of visible quads is uploaded. Drawing happens inside ImGui's render pass
+// via a draw list callback, so it layers with the rest of the UI as before
+class Wireframe {
+
+	public:
+		// Constructors
+		Wireframe(const char *glsl_version);
+		Wireframe() = delete;
+
+		// Destructor
+		~Wireframe();
+
+		Wireframe(const Wireframe &) = delete;
+		auto operator=(const Wireframe &) -> Wireframe & = delete;
+
+		// Public Methods
+		auto build(std::map<Coordinate3, TileView> &tileviews,
+				   const ImVec2 source_size) -> void;
+		auto is_available() -> bool;
+		auto begin(const ImVec2 pos, const float scale) -> void;
+		auto add(const VertexArray &array) -> void;
+		auto submit(ImDrawList *draw_list, const Image &image,
+					const float fade, const bool monochrome) -> void;
+
+	private:
+		// Vertex layout in the buffer (position in view pane coordinates,
+		// texture coordinates relative to the wireframe image)
+		struct WireframeVertex {
+				float x;
+				float y;
+				float u;
+				float v;
+				float r;
+				float g;
+				float b;
+		};
+
+		// Private Methods
+		static auto _callback(const ImDrawList *draw_list, const ImDrawCmd *cmd)
+			-> void;
+		auto _init() -> bool;
+		auto _compile(const GLenum type, std::string_view source) -> GLuint;
+		auto _render() -> void;
+
+		// Private Members
+		std::string _glsl_version;
+		std::optional<bool> _available;
+		bool _dirty;
+		GLuint _program;
+		GLuint _vao;
+		GLuint _vbo;
+		GLuint _ebo;
+		GLint _u_offset;
+		GLint _u_scale;
+		GLint _u_display;
+		GLint _u_uv_rect;
+		GLint _u_fade;
+		GLint _u_monochrome;
+		GLint _u_texture;
+		std::vector<WireframeVertex> _vertices;
+		std::vector<GLushort> _indices;
+
+		// Frame state, used when the callback runs
+		ImVec2 _pos;
+		float _scale;
+		ImVec4 _display;
+		ImVec4 _uv_rect;
+		GLuint _texture;
+		float _fade;
+		bool _monochrome;
+};
+
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "engine/define.hpp"
+#include "types/dice.hpp"
+#include "types/enum.hpp"
+
+namespace Sorcery {
+
+// Forward Declarations
+class Character;
+class Resources;
+
+// A group of the same type of monster; its monsters are [first, first + count)
+// in the per-monster arrays
+struct CombatGroup {
+		Enums::Monsters::TypeID type;
+		unsigned int first;
+		unsigned int count;
+		int level;
+		std::vector<Dice> attacks;
+};
+
+// What happened in one round
+struct CombatRound {
+		std::vector<int> group_damage;	// Total damage dealt to each group
+		std::vector<int> group_killed;	// Monsters killed in each group
+		std::vector<int> party_damage;	// Damage taken by each party member
+		unsigned int party_hits;
+		unsigned int monster_hits;
+};
+
+// Resolves combat rounds with no UI. Monsters are kept as a structure of
+// arrays (hp, ac, status) with each group a contiguous range, and the party is
+// a snapshot of what combat needs from each character; to hit and damage rolls
+// are made in batches for a whole group or party member at a time. Apply the
+// party damage from each round back to the characters with Character::damage
+class Combat {
+
+	public:
+		// Constructors
+		Combat(Resources *resources, const std::uint64_t seed);
+		Combat() = delete;
+
+		// Public Methods
+		auto add_group(const Enums::Monsters::TypeID type,
+					   const unsigned int count) -> unsigned int;
+		auto add_character(const Character &character) -> void;
+		auto resolve_round(std::span<const int> targets) -> CombatRound;
+		auto get_groups() const -> std::span<const CombatGroup>;
+		auto get_alive(const unsigned int group) const -> unsigned int;
+		auto get_monster_hp() const -> std::span<const int>;
+		auto get_party_hp() const -> std::span<const int>;
+		auto is_over() const -> bool;
+		auto set_asleep(const unsigned int group, const bool value) -> void;
+
+	private:
+		// Private Methods
+		auto _roll(const unsigned int count, const unsigned int sides,
+				   std::vector<int> &rolls) -> void;
+		auto _roll(const Dice &dice, const unsigned int count,
+				   std::vector<int> &rolls) -> void;
+		auto _party_attacks(std::span<const int> targets, CombatRound &round)
+			-> void;
+		auto _monster_attacks(CombatRound &round) -> void;
+
+		// Private Members
+		Resources *_resources;
+		std::mt19937_64 _random;
+		std::vector<CombatGroup> _groups;
+
+		// One entry per monster, across all groups
+		std::vector<int> _monster_hp;
+		std::vector<int> _monster_ac;
+		std::vector<std::uint8_t> _monster_status;
+
+		// One entry per party member
+		std::vector<int> _party_hp;
+		std::vector<int> _party_ac;
+		std::vector<int> _party_to_hit;
+		std::vector<int> _party_swings;
+		std::vector<Dice> _party_damage;
+		std::vector<std::uint8_t> _party_status;
+
+		// Batched rolls (kept to save allocating them every round)
+		std::vector<int> _to_hit_rolls;
+		std::vector<int> _damage_rolls;
+		std::vector<int> _target_rolls;
+};
+
+}
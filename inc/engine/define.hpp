@@ -35,4 +35,18 @@ inline constexpr auto MOVE_BACKWARD{4};
 
 inline constexpr auto RETURN_TO_TOWN(-5);
 
+// Combat (a hit needs d20 + to hit + AC to reach the target)
+inline constexpr auto COMBAT_TO_HIT_DIE{20u};
+inline constexpr auto COMBAT_TO_HIT_TARGET{21};
+inline constexpr auto COMBAT_FRONT_ROW{3u};
+inline constexpr auto COMBAT_UNARMED_SIDES{2u};
+inline constexpr auto COMBAT_ALIVE{1u};
+inline constexpr auto COMBAT_AWAKE{2u};
+
+// Encounter Simulator (gold is a stand-in until there are treasure tables)
+inline constexpr auto SIM_MAX_GROUPS{4u};
+inline constexpr auto SIM_MAX_ROUNDS{50u};
+inline constexpr auto SIM_CHUNK_SIZE{64u};
+inline constexpr auto SIM_GOLD_SIDES{10u};
+
 };
\ No newline at end of file
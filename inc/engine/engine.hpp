@@ -85,6 +85,7 @@ class Engine {
 		std::unique_ptr<Options> _options;
 		std::unique_ptr<Reorder> _reorder;
 		std::unique_ptr<Inspect> _inspect;
+		SDL_TimerID _ouch_tick;
 };
 
 }
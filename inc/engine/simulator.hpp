@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "engine/define.hpp"
+#include "types/character.hpp"
+#include "types/enum.hpp"
+
+namespace Sorcery {
+
+// Forward Declarations
+class Resources;
+class System;
+
+// What to simulate (depth is 1 for the first level down)
+struct SimulationConfig {
+		int depth;
+		unsigned int level;
+		unsigned int encounters;
+		unsigned int parties;
+		unsigned int threads;
+		std::uint64_t seed;
+};
+
+// Running totals; each worker keeps its own (on its own cache line) and they
+// are added together at the end
+struct alignas(64) SimulationTotals {
+		std::uint64_t encounters;
+		std::uint64_t wins;
+		std::uint64_t rounds;
+		std::uint64_t hp_lost;
+		std::uint64_t xp;
+		std::uint64_t gold;
+};
+
+struct SimulationResult {
+		SimulationTotals totals;
+		unsigned int threads;
+		std::chrono::nanoseconds elapsed;
+};
+
+// Plays out encounters between generated parties and random monster groups
+// for a depth, with no UI, spread across a thread pool. Every encounter has
+// its own RNG stream seeded from the config seed and its index, so results are
+// the same whatever the number of threads
+class Simulator {
+
+	public:
+		// Constructors
+		Simulator(System *system, Resources *resources,
+				  const SimulationConfig &config);
+		Simulator() = delete;
+
+		// Public Methods
+		auto get_monster_types() const
+			-> std::span<const Enums::Monsters::TypeID>;
+		auto run() -> SimulationResult;
+
+	private:
+		// Private Methods
+		auto _create_parties() -> void;
+		auto _encounter(const std::uint64_t index,
+						SimulationTotals &totals) const -> void;
+
+		// Private Members
+		System *_system;
+		Resources *_resources;
+		SimulationConfig _config;
+		unsigned int _depth;
+		std::vector<std::vector<Character>> _parties;
+};
+
+}
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "common/include.hpp"
+
 namespace Sorcery {
 
 // Menu Options
@@ -91,6 +93,13 @@ inline constexpr auto RECOVERY_MODE_COST_10{2};
 inline constexpr auto RECOVERY_MODE_COST_50{4};
 inline constexpr auto RECOVERY_MODE_COST_200{8};
 inline constexpr auto RECOVERY_MODE_COST_500{16};
+
+// Weekly cost in gold and hit points healed for each paid recovery mode
+inline constexpr std::array<std::array<int, 3>, 4> RECOVERY_RATES{
+	{{RECOVERY_MODE_COST_10, 10, 1},
+	 {RECOVERY_MODE_COST_50, 50, 3},
+	 {RECOVERY_MODE_COST_200, 200, 5},
+	 {RECOVERY_MODE_COST_500, 500, 10}}};
 inline constexpr auto INSPECT_MODE_TAVERN{1};
 inline constexpr auto INSPECT_MODE_CAMP{2};
 inline constexpr auto INSPECT_MODE_INN{3};
@@ -104,6 +113,9 @@ inline constexpr auto COMPENDIUM_BESTIARY{1};
 inline constexpr auto COMPENDIUM_MUSEUM{3};
 inline constexpr auto COMPENDIUM_SPELLBOOK{4};
 
+// Text layout results kept before the cache is flushed
+inline constexpr auto TEXT_CACHE_SIZE{4096u};
+
 // Party Menu Mode
 inline constexpr auto NO_FLAGS{0};
 inline constexpr auto MENU_SHOW_POSITION{1};
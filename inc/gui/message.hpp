@@ -38,7 +38,7 @@ class Message {
 
 		auto display(bool &is_yes) -> void;
 		auto id() const -> std::string;
-		auto set(std::vector<std::string> strings,
+		auto set(std::span<const std::string_view> strings,
 				 const Enums::Map::Event event_id) -> void;
 		auto name() const -> std::string;
 
@@ -51,7 +51,7 @@ class Message {
 		std::string _id;
 		std::string _name;
 		std::string _str;
-		std::vector<std::string> _strings;
+		std::span<const std::string_view> _strings;
 		Enums::Map::Event _event_id;
 };
 
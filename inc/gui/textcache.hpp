@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "gui/define.hpp"
+
+namespace Sorcery {
+
+// Everything text layout depends on. The text itself is kept, not just a hash
+// of it, so that two strings can never share a layout
+struct TextLayoutKey {
+		const ImFont *font;
+		float size;
+		float width;
+		std::string text;
+};
+
+// The same, for looking up a layout without copying the text
+struct TextLayoutView {
+		const ImFont *font;
+		float size;
+		float width;
+		std::string_view text;
+};
+
+struct TextLayoutHash {
+
+		using is_transparent = void;
+
+		auto operator()(const TextLayoutView &key) const -> std::size_t;
+		auto operator()(const TextLayoutKey &key) const -> std::size_t;
+};
+
+struct TextLayoutEqual {
+
+		using is_transparent = void;
+
+		template <typename First, typename Second>
+		auto operator()(const First &first, const Second &second) const
+			-> bool {
+
+			return first.font == second.font && first.size == second.size &&
+				   first.width == second.width &&
+				   std::string_view{first.text} ==
+					   std::string_view{second.text};
+		}
+};
+
+// Generated text is keyed on what it is, which character it is for, and (where
+// there is more than one) which
+struct TextKey {
+		std::string name;
+		int id;
+		int index;
+
+		auto operator==(const TextKey &other) const -> bool = default;
+};
+
+struct TextKeyHash {
+
+		auto operator()(const TextKey &key) const -> std::size_t;
+};
+
+// Caches text measurement and wrapping for the current ImGui font (keyed on
+// the font, its size and the text), and memoises generated strings against a
+// revision so that unchanged text is not rebuilt every frame
+class TextCache {
+
+	public:
+		// Constructors
+		TextCache();
+
+		// Public Methods
+		auto get_size(std::string_view text) -> ImVec2;
+		auto get_wrapped(std::string_view text, const float width)
+			-> const std::string &;
+		auto invalidate() -> void;
+		auto clear() -> void;
+
+		template <typename Generator>
+		auto get_text(const TextKey &key, const std::uint64_t revision,
+					  Generator &&generator) -> const std::string & {
+
+			if (_texts.size() > TEXT_CACHE_SIZE)
+				_texts.clear();
+
+			auto &[cached, text]{_texts[key]};
+			if (cached != revision || text.empty()) {
+				text = generator();
+				cached = revision;
+			}
+
+			return text;
+		}
+
+		static auto make_key(std::string_view name, const int id,
+							 const int index = 0) -> TextKey;
+
+	private:
+		// Private Methods
+		auto _get_key(std::string_view text, const float width = 0.0f) const
+			-> TextLayoutView;
+
+		// Private Members
+		std::unordered_map<TextLayoutKey, ImVec2, TextLayoutHash,
+						   TextLayoutEqual>
+			_sizes;
+		std::unordered_map<TextLayoutKey, std::string, TextLayoutHash,
+						   TextLayoutEqual>
+			_wrapped;
+		std::unordered_map<TextKey, std::pair<std::uint64_t, std::string>,
+						   TextKeyHash>
+			_texts;
+};
+
+}
@@ -40,6 +40,7 @@ class ComponentStore {
 		auto get(std::string_view combined_key) -> Component &;
 		auto get_custom(std::string_view screen)
 			-> std::optional<std::vector<Component>>;
+		auto get_string_keys() const -> std::vector<std::string>;
 
 	private:
 		auto load(const std::filesystem::path filename) -> bool;
@@ -54,6 +54,7 @@ inline constexpr auto TEXT_FONT_FILE{"text.ttf"sv};
 
 inline constexpr auto BACKGROUND_MAIN_MENU_TEXTURE{"background-mm.png"sv};
 inline constexpr auto BANNER_TEXTURE{"banner.png"sv};
+inline constexpr auto DUNGEON_TEXTURE{"dungeon.png"sv};
 inline constexpr auto KNOWN_CREATURES_TEXTURE{"known.png"sv};
 inline constexpr auto ICONS_TEXTURE{"icons.png"sv};
 inline constexpr auto ITEMS_TEXTURE{"items.png"sv};
@@ -63,6 +64,19 @@ inline constexpr auto MAINMENU_VIDEO{"mainmenu.mp4"sv};
 inline constexpr auto UNKNOWN_CREATURES_TEXTURE{"unknown.png"sv};
 inline constexpr auto WIREFRAME_TEXTURE{"wireframe.png"sv};
 
+// Texture residency (budget can be overridden in config.ini)
+inline constexpr auto ATLAS_SIZE{2048};
+inline constexpr auto ATLAS_MAX_IMAGE_SIZE{1024};
+inline constexpr auto ATLAS_PADDING{2};
+inline constexpr auto DEFAULT_TEXTURE_BUDGET_MB{256u};
+inline constexpr auto TEXTURE_BUDGET_KEY{"texture_budget_mb"sv};
+
+// Loot and encounter tables (a treasure level for each level of the dungeon;
+// anything dearer than LOOT_MAX_VALUE is a quest item and never found)
+inline constexpr auto LOOT_LEVELS{10u};
+inline constexpr auto LOOT_MAX_VALUE{1000000u};
+inline constexpr auto ENCOUNTER_LEVEL_SPREAD{2u};
+
 // Miscellaneous error strings
 static const std::string KEY_NOT_FOUND{"KEY NOT FOUND"};
 static const std::string STRINGS_NOT_LOADED{"GAME STRINGS NOT LOADED"};
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "common/types.hpp"
+#include "resources/define.hpp"
+#include "types/aliastable.hpp"
+#include "types/enum.hpp"
+
+namespace Sorcery {
+
+// Forward Declarations
+class MonsterStore;
+class System;
+
+// Weighted monster tables for random encounters, built once from the monster
+// store: for each depth (1 being the first level down), the monsters of that
+// level up to ENCOUNTER_LEVEL_SPREAD above it, with those nearest the depth
+// the most common, both overall and by monster category. Each draw is
+// constant time, either from the system RNG or one given (for use off the
+// main thread)
+class EncounterTable {
+
+	public:
+		// Constructors
+		EncounterTable(System *system, const MonsterStore &monsters);
+		EncounterTable() = delete;
+
+		// Public Methods
+		auto get_depths() const -> unsigned int;
+		auto get_types(const unsigned int depth) const
+			-> std::span<const Enums::Monsters::TypeID>;
+		auto draw(const unsigned int depth) const
+			-> std::optional<Enums::Monsters::TypeID>;
+		auto draw(const unsigned int depth, std::mt19937_64 &random) const
+			-> std::optional<Enums::Monsters::TypeID>;
+		auto draw(const unsigned int depth, const unsigned int count,
+				  std::vector<Enums::Monsters::TypeID> &types) const -> bool;
+		auto draw(const unsigned int depth, const unsigned int count,
+				  std::vector<Enums::Monsters::TypeID> &types,
+				  std::mt19937_64 &random) const -> bool;
+		auto draw(const unsigned int depth,
+				  const Enums::Monsters::Category category) const
+			-> std::optional<Enums::Monsters::TypeID>;
+		auto draw(const unsigned int depth,
+				  const Enums::Monsters::Category category,
+				  std::mt19937_64 &random) const
+			-> std::optional<Enums::Monsters::TypeID>;
+		auto draw(const unsigned int depth,
+				  const Enums::Monsters::Category category,
+				  const unsigned int count,
+				  std::vector<Enums::Monsters::TypeID> &types) const -> bool;
+		auto draw(const unsigned int depth,
+				  const Enums::Monsters::Category category,
+				  const unsigned int count,
+				  std::vector<Enums::Monsters::TypeID> &types,
+				  std::mt19937_64 &random) const -> bool;
+
+	private:
+		struct Table {
+				AliasTable alias;
+				std::vector<Enums::Monsters::TypeID> types;
+		};
+
+		// Private Methods
+		auto _get_depth(const unsigned int depth) const -> const Table *;
+		auto _get_category(const unsigned int depth,
+						   const Enums::Monsters::Category category) const
+			-> const Table *;
+		auto _draw(const Table *table, const std::uint64_t bits) const
+			-> std::optional<Enums::Monsters::TypeID>;
+		template <class Bits>
+		auto _draw(const Table *table, const unsigned int count,
+				   std::vector<Enums::Monsters::TypeID> &types,
+				   Bits &&bits) const -> bool;
+
+		// Private Members
+		System *_system;
+		std::vector<Table> _depths;
+		std::vector<EnumMap<Enums::Monsters::Category, Table>> _categories;
+};
+
+}
@@ -23,20 +23,32 @@
 #pragma once
 
 #include "common/include.hpp"
+#include "common/types.hpp"
+#include "types/image.hpp"
 
 namespace Sorcery {
 
 class System;
-class Image;
+class TextureAtlas;
 
+// Images are referred to by integer handles (resolve once with handle()).
+// Small sprite sheets are packed into shared atlases and stay resident, while
+// everything else is loaded on first use and evicted least-recently-used
+// first when over the VRAM budget
 class ImageStore {
 
 	public:
 		ImageStore(System *system);
+		~ImageStore();
 
-		auto get(const std::string file) -> Image;
-		auto has_loaded(const std::string file) -> bool;
-		auto load_image(const std::string file) -> bool;
+		auto get(const unsigned int handle) -> const Image &;
+		auto get(std::string_view file) -> const Image &;
+		auto handle(std::string_view file) const -> unsigned int;
+		auto has_loaded(const unsigned int handle) const -> bool;
+		auto has_loaded(std::string_view file) const -> bool;
+		auto load_image(std::string_view file) -> bool;
+		auto next_frame() -> void;
+		auto resident_bytes() const -> std::size_t;
 
 		bool loaded;
 		unsigned int progress;
@@ -45,13 +57,23 @@ class ImageStore {
 
 	private:
 		auto _initialise() -> bool;
-		auto _load_texture_from_disc(const char *filename, GLuint *out_texture,
-									 int *out_width, int *out_height) -> bool;
-		auto _load_image(const std::string key) -> bool;
+		auto _evict(const std::size_t needed) -> void;
+		auto _load_image(const unsigned int handle) -> bool;
+		auto _pack_into_atlas(Image &image, const unsigned char *pixels)
+			-> bool;
+		auto _upload_texture(Image &image, const unsigned char *pixels)
+			-> void;
 
 		System *_system;
-		std::map<std::string, Image> _images;
-		std::map<std::string, bool> _loaded;
+		std::vector<Image> _images;
+		std::unordered_map<std::string, unsigned int, StringHash,
+						   std::equal_to<>>
+			_handles;
 		std::vector<std::string> _sources;
+		std::vector<std::string> _sheets;
+		std::vector<std::unique_ptr<TextureAtlas>> _atlases;
+		std::size_t _budget;
+		std::size_t _resident;
+		std::uint64_t _frame;
 };
-}
\ No newline at end of file
+}
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "common/include.hpp"
+#include "common/types.hpp"
 #include "types/enum.hpp"
 #include "types/item.hpp"
 #include "types/itemtype.hpp"
@@ -31,25 +32,28 @@ namespace Sorcery {
 
 class System;
 
+// Item types are stored densely by TypeID, with the name and category indexes
+// built once at load time so that lookups never need a search or a copy
 class ItemStore {
 
 	public:
 		ItemStore(System *system, const std::filesystem::path filename);
 		ItemStore() = delete;
 
-		auto operator[](Enums::Items::TypeID item_type_id) const -> ItemType;
-		auto operator[](unsigned int item_type_id) const -> ItemType;
+		auto operator[](Enums::Items::TypeID item_type_id) const
+			-> const ItemType &;
+		auto operator[](unsigned int item_type_id) const -> const ItemType &;
 		auto operator()(Enums::Items::Category category) const
-			-> std::vector<ItemType>;
-		auto operator[](std::string name) const -> ItemType;
+			-> std::span<const ItemType *const>;
+		auto operator[](std::string_view name) const -> const ItemType &;
 
 		auto get_item_type(const Enums::Items::TypeID item_type_id) const
-			-> ItemType;
+			-> const ItemType &;
 		auto get_an_item(const Enums::Items::TypeID item_type_id) const -> Item;
 		auto get_random_item(const Enums::Items::TypeID min_item_type_id,
 							 const Enums::Items::TypeID max_item_type_id) const
 			-> Item;
-		auto get_all_types() const -> std::vector<ItemType>;
+		auto get_all_types() const -> std::span<const ItemType>;
 		auto is_usable(const Enums::Items::TypeID item_type_id,
 					   const Enums::Character::Class cclass,
 					   const Enums::Character::Align calign) const -> bool;
@@ -63,10 +67,16 @@ class ItemStore {
 
 	private:
 		System *_system;
-		std::map<Enums::Items::TypeID, ItemType> _items;
+		std::vector<ItemType> _items;
+		std::unordered_map<std::string, unsigned int, StringHash,
+						   std::equal_to<>>
+			_names;
+		EnumMap<Enums::Items::Category, std::vector<const ItemType *>>
+			_categories;
 		bool _loaded;
 
 		auto _load(const std::filesystem::path filename) -> bool;
+		auto _build_indexes() -> void;
 		auto _get_defensive_effects(const std::string defensive_s) const
 			-> std::array<bool, 22>;
 		auto _get_offensive_effects(const std::string offsensive_s) const
@@ -0,0 +1,93 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "common/types.hpp"
+#include "resources/define.hpp"
+#include "types/aliastable.hpp"
+#include "types/enum.hpp"
+
+namespace Sorcery {
+
+// Forward Declarations
+class ItemStore;
+class System;
+
+// Weighted item tables for treasure, built once from the item store: one for
+// each treasure level (for a chest on that level of the dungeon) and one for
+// each item category. Cheap items are more common than dear ones, less so
+// the deeper the chest. Each draw is constant time, either from the system
+// RNG or one given (for use off the main thread)
+class LootTable {
+
+	public:
+		// Constructors
+		LootTable(System *system, const ItemStore &items);
+		LootTable() = delete;
+
+		// Public Methods
+		auto draw(const unsigned int level) const
+			-> std::optional<Enums::Items::TypeID>;
+		auto draw(const unsigned int level, std::mt19937_64 &random) const
+			-> std::optional<Enums::Items::TypeID>;
+		auto draw(const unsigned int level, const unsigned int count,
+				  std::vector<Enums::Items::TypeID> &types) const -> bool;
+		auto draw(const unsigned int level, const unsigned int count,
+				  std::vector<Enums::Items::TypeID> &types,
+				  std::mt19937_64 &random) const -> bool;
+		auto draw(const Enums::Items::Category category) const
+			-> std::optional<Enums::Items::TypeID>;
+		auto draw(const Enums::Items::Category category,
+				  std::mt19937_64 &random) const
+			-> std::optional<Enums::Items::TypeID>;
+		auto draw(const Enums::Items::Category category,
+				  const unsigned int count,
+				  std::vector<Enums::Items::TypeID> &types) const -> bool;
+		auto draw(const Enums::Items::Category category,
+				  const unsigned int count,
+				  std::vector<Enums::Items::TypeID> &types,
+				  std::mt19937_64 &random) const -> bool;
+
+	private:
+		struct Table {
+				AliasTable alias;
+				std::vector<Enums::Items::TypeID> types;
+		};
+
+		// Private Methods
+		auto _get_level(const unsigned int level) const -> const Table &;
+		auto _draw(const Table &table, const std::uint64_t bits) const
+			-> std::optional<Enums::Items::TypeID>;
+		template <class Bits>
+		auto _draw(const Table &table, const unsigned int count,
+				   std::vector<Enums::Items::TypeID> &types, Bits &&bits) const
+			-> bool;
+
+		// Private Members
+		System *_system;
+		std::array<Table, LOOT_LEVELS> _levels;
+		EnumMap<Enums::Items::Category, Table> _categories;
+};
+
+}
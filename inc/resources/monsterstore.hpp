@@ -23,6 +23,7 @@
 #pragma once
 
 #include "common/define.hpp"
+#include "common/types.hpp"
 #include "resources/define.hpp"
 #include "types/dice.hpp"
 #include "types/enum.hpp"
@@ -33,6 +34,8 @@ namespace Sorcery {
 // Forward Declaration
 class System;
 
+// Monster types are stored densely by TypeID, with a name index built once at
+// load time so that lookups never need a search or a copy
 class MonsterStore {
 
 	public:
@@ -41,26 +44,30 @@ class MonsterStore {
 
 		// Overload operators
 		auto operator[](Enums::Monsters::TypeID monster_type_id) const
-			-> MonsterType;
-		auto operator[](int monster_type_id) const -> MonsterType;
+			-> const MonsterType &;
+		auto operator[](int monster_type_id) const -> const MonsterType &;
 		// auto operator()(ITC category) const -> std::vector<ItemType>;
-		auto operator[](std::string name) const -> MonsterType;
+		auto operator[](std::string_view name) const -> const MonsterType &;
 
 		// Public methods
 		// auto get_a_monster(const MTI monster_type_id) const -> Monster;
 		// auto get_random_monster(
 		//	const MTI min_monster_type_id, const MTI max_monster_type_id) const
 		//-> Monster;
-		auto get_all_types() const -> std::vector<MonsterType>;
+		auto get_all_types() const -> std::span<const MonsterType>;
 
 	private:
 		// Private members
 		System *_system;
-		std::map<Enums::Monsters::TypeID, MonsterType> _items;
+		std::vector<MonsterType> _items;
+		std::unordered_map<std::string, unsigned int, StringHash,
+						   std::equal_to<>>
+			_names;
 		bool _loaded;
 
 		// Private methods
 		auto _load(const std::filesystem::path filename) -> bool;
+		auto _build_indexes() -> void;
 		auto _parse_attacks(const std::string value) const -> std::vector<Dice>;
 		auto _parse_breath_weapons(const std::string value) const
 			-> Enums::Monsters::Breath;
@@ -24,6 +24,7 @@
 
 #include "common/include.hpp"
 #include "common/types.hpp"
+#include "types/define.hpp"
 #include "types/enum.hpp"
 
 namespace Sorcery {
@@ -31,6 +32,8 @@ namespace Sorcery {
 // Forward Declaration
 class System;
 
+// The one (immutable) catalogue of spell details; characters only keep a
+// bitset of the spells they know, indexed by SpellID
 class SpellStore {
 
 	public:
@@ -38,21 +41,30 @@ class SpellStore {
 		SpellStore(System *system);
 
 		// Overload [] operator
-		auto operator[](Enums::Magic::SpellID spell_id) const -> Spell;
+		auto operator[](Enums::Magic::SpellID spell_id) const -> const Spell &;
 		auto operator()(Enums::Magic::SpellCategory category) const
 			-> std::vector<Spell>;
-		auto operator[](std::string name) const -> Spell;
+		auto operator[](std::string_view name) const -> const Spell &;
 
 		// Public Methods
-		auto get_all() -> std::vector<Spell>;
+		auto get_all() const -> const std::vector<Spell> &;
+		auto get_mask(const Enums::Magic::SpellType type,
+					  const unsigned int level) const
+			-> const std::bitset<NUM_SPELLS> &;
 
 	private:
 		// Private Members
 		System *_system;
 		bool _loaded;
 		std::vector<Spell> _spells;
+		std::array<unsigned int, NUM_SPELLS> _index;
+		std::unordered_map<std::string, unsigned int, StringHash,
+						   std::equal_to<>>
+			_names;
+		std::array<std::array<std::bitset<NUM_SPELLS>, 8>, 2> _masks;
 
 		// Private Functions
 		auto _load() -> void;
+		auto _build_index() -> void;
 };
 }
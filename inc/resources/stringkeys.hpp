@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+// Every string key looked up by name in the code (keys built at run time, such
+// as those for menu items, are not included). These are checked against the
+// strings file at startup, so add any new literal lookups here too
+inline constexpr std::array<std::string_view, 231> CODE_STRING_KEYS{
+	// src/core/display.cpp
+	"WINDOW_TITLE"sv,
+	// src/core/ui.cpp
+	"REST_BIRTHDAY_YOU"sv, "PAY_COST_PREFIX"sv, "PAY_COST_SUFFIX"sv,
+	"REST_NEED_1_P"sv, "REST_NEED_1_S"sv, "REST_NEED_2"sv, "TEMPLE_HEAL_1"sv,
+	"TEMPLE_HEAL_2"sv, "TEMPLE_HEAL_3"sv, "TEMPLE_HEAL_4"sv,
+	"RECOVERY_NAPPING"sv, "REST_RECUPERATING"sv, "REST_HP"sv, "REST_GOLD"sv,
+	"STAY_WELCOME_P"sv, "STAY_WELCOME_S"sv, "STAY_GOLD_P"sv, "STAY_GOLD_S"sv,
+	"DIALOG_SAVE"sv, "DIALOG_CANCEL"sv, "PARTY_PANEL_LEGEND"sv,
+	"BESTIARY_RETURN"sv, "SPELLBOOK_RETURN"sv, "MUSEUM_RETURN"sv,
+	// src/gui/dialog.cpp
+	"DIALOG_YES"sv, "DIALOG_NO"sv, "DIALOG_OK"sv,
+	// src/gui/input.cpp
+	"INPUT_OK"sv,
+	// src/gui/message.cpp
+	"MESSAGE_CONTINUE"sv,
+	// src/modules/heal.cpp
+	"TEMPLE_HEALED_PREFIX"sv, "TEMPLE_HEALED_SUFFIX"sv,
+	"TEMPLE_OOPS_DEAD_PREFIX"sv, "TEMPLE_OOPS_DEAD_SUFFIX"sv,
+	"TEMPLE_OOPS_ASHES_PREFIX"sv, "TEMPLE_OOPS_ASHES_SUFFIX"sv,
+	// src/resources/spellstore.cpp
+	"SPELL_DUMAPIC_NAME"sv, "SPELL_DUMAPIC_TITLE"sv, "SPELL_DUMAPIC_DESC"sv,
+	"SPELL_HALITO_NAME"sv, "SPELL_HALITO_TITLE"sv, "SPELL_HALITO_DESC"sv,
+	"SPELL_KATINO_NAME"sv, "SPELL_KATINO_TITLE"sv, "SPELL_KATINO_DESC"sv,
+	"SPELL_MOGREF_NAME"sv, "SPELL_MOGREF_TITLE"sv, "SPELL_MOGREF_DESC"sv,
+	"SPELL_DILTO_NAME"sv, "SPELL_DILTO_TITLE"sv, "SPELL_DILTO_DESC"sv,
+	"SPELL_SOPIC_NAME"sv, "SPELL_SOPIC_TITLE"sv, "SPELL_SOPIC_DESC"sv,
+	"SPELL_MAHALITO_NAME"sv, "SPELL_MAHALITO_TITLE"sv, "SPELL_MAHALITO_DESC"sv,
+	"SPELL_MOLITO_NAME"sv, "SPELL_MOLITO_TITLE"sv, "SPELL_MOLITO_DESC"sv,
+	"SPELL_DALTO_NAME"sv, "SPELL_DALTO_TITLE"sv, "SPELL_DALTO_DESC"sv,
+	"SPELL_LAHALITO_NAME"sv, "SPELL_LAHALITO_TITLE"sv, "SPELL_LAHALITO_DESC"sv,
+	"SPELL_MORLIS_NAME"sv, "SPELL_MORLIS_TITLE"sv, "SPELL_MORLIS_DESC"sv,
+	"SPELL_MADALTO_NAME"sv, "SPELL_MADALTO_TITLE"sv, "SPELL_MADALTO_DESC"sv,
+	"SPELL_MAKANITO_NAME"sv, "SPELL_MAKANITO_TITLE"sv, "SPELL_MAKANITO_DESC"sv,
+	"SPELL_MAMORLIS_NAME"sv, "SPELL_MAMORLIS_TITLE"sv, "SPELL_MAMORLIS_DESC"sv,
+	"SPELL_HAMAN_NAME"sv, "SPELL_HAMAN_TITLE"sv, "SPELL_HAMAN_DESC"sv,
+	"SPELL_LAKANITO_NAME"sv, "SPELL_LAKANITO_TITLE"sv, "SPELL_LAKANITO_DESC"sv,
+	"SPELL_MASOPIC_NAME"sv, "SPELL_MASOPIC_TITLE"sv, "SPELL_MASOPIC_DESC"sv,
+	"SPELL_ZILWAN_NAME"sv, "SPELL_ZILWAN_TITLE"sv, "SPELL_ZILWAN_DESC"sv,
+	"SPELL_MAHAMAN_NAME"sv, "SPELL_MAHAMAN_TITLE"sv, "SPELL_MAHAMAN_DESC"sv,
+	"SPELL_MALOR_NAME"sv, "SPELL_MALOR_TITLE"sv, "SPELL_MALOR_DESC"sv,
+	"SPELL_TILTOWAIT_NAME"sv, "SPELL_TILTOWAIT_TITLE"sv,
+	"SPELL_TILTOWAIT_DESC"sv, "SPELL_BADIOS_NAME"sv, "SPELL_BADIOS_TITLE"sv,
+	"SPELL_BADIOS_DESC"sv, "SPELL_DIOS_NAME"sv, "SPELL_DIOS_TITLE"sv,
+	"SPELL_DIOS_DESC"sv, "SPELL_KALKI_NAME"sv, "SPELL_KALKI_TITLE"sv,
+	"SPELL_KALKI_DESC"sv, "SPELL_MILWA_NAME"sv, "SPELL_MILWA_TITLE"sv,
+	"SPELL_MILWA_DESC"sv, "SPELL_PORFIC_NAME"sv, "SPELL_PORFIC_TITLE"sv,
+	"SPELL_PORFIC_DESC"sv, "SPELL_CALFO_NAME"sv, "SPELL_CALFO_TITLE"sv,
+	"SPELL_CALFO_DESC"sv, "SPELL_MANIFO_NAME"sv, "SPELL_MANIFO_TITLE"sv,
+	"SPELL_MANIFO_DESC"sv, "SPELL_MATU_NAME"sv, "SPELL_MATU_TITLE"sv,
+	"SPELL_MATU_DESC"sv, "SPELL_MONTINO_NAME"sv, "SPELL_MONTINO_TITLE"sv,
+	"SPELL_MONTINO_DESC"sv, "SPELL_BAMATU_NAME"sv, "SPELL_BAMATU_TITLE"sv,
+	"SPELL_BAMATU_DESC"sv, "SPELL_DIALKO_NAME"sv, "SPELL_DIALKO_TITLE"sv,
+	"SPELL_DIALKO_DESC"sv, "SPELL_LATUMAPIC_NAME"sv, "SPELL_LATUMAPIC_TITLE"sv,
+	"SPELL_LATUMAPIC_DESC"sv, "SPELL_LOMILWA_NAME"sv, "SPELL_LOMILWA_TITLE"sv,
+	"SPELL_LOMILWA_DESC"sv, "SPELL_BADIAL_NAME"sv, "SPELL_BADIAL_TITLE"sv,
+	"SPELL_BADIAL_DESC"sv, "SPELL_DIAL_NAME"sv, "SPELL_DIAL_TITLE"sv,
+	"SPELL_DIAL_DESC"sv, "SPELL_LATUMOFIS_NAME"sv, "SPELL_LATUMOFIS_TITLE"sv,
+	"SPELL_LATUMOFIS_DESC"sv, "SPELL_MAPORFIC_NAME"sv, "SPELL_MAPORFIC_TITLE"sv,
+	"SPELL_MAPORFIC_DESC"sv, "SPELL_BADI_NAME"sv, "SPELL_BADI_TITLE"sv,
+	"SPELL_BADI_DESC"sv, "SPELL_BADIALMA_NAME"sv, "SPELL_BADIALMA_TITLE"sv,
+	"SPELL_BADIALMA_DESC"sv, "SPELL_DI_NAME"sv, "SPELL_DI_TITLE"sv,
+	"SPELL_DI_DESC"sv, "SPELL_DIALMA_NAME"sv, "SPELL_DIALMA_TITLE"sv,
+	"SPELL_DIALMA_DESC"sv, "SPELL_KANDI_NAME"sv, "SPELL_KANDI_TITLE"sv,
+	"SPELL_KANDI_DESC"sv, "SPELL_LITOKAN_NAME"sv, "SPELL_LITOKAN_TITLE"sv,
+	"SPELL_LITOKAN_DESC"sv, "SPELL_LOKTOFEIT_NAME"sv, "SPELL_LOKTOFEIT_TITLE"sv,
+	"SPELL_LOKTOFEIT_DESC"sv, "SPELL_LORTO_NAME"sv, "SPELL_LORTO_TITLE"sv,
+	"SPELL_LORTO_DESC"sv, "SPELL_MABADI_NAME"sv, "SPELL_MABADI_TITLE"sv,
+	"SPELL_MABADI_DESC"sv, "SPELL_MADI_NAME"sv, "SPELL_MADI_TITLE"sv,
+	"SPELL_MADI_DESC"sv, "SPELL_KADORTO_NAME"sv, "SPELL_KADORTO_TITLE"sv,
+	"SPELL_KADORTO_DESC"sv, "SPELL_MALIKTO_NAME"sv, "SPELL_MALIKTO_TITLE"sv,
+	"SPELL_MALIKTO_DESC"sv,
+	// src/types/character.cpp
+	"CHARACTER_ALIGNMENT_GOOD"sv, "CHARACTER_ALIGNMENT_NEUTRAL"sv,
+	"CHARACTER_ALIGNMENT_EVIL"sv, "CHARACTER_RACE_HUMAN"sv,
+	"CHARACTER_RACE_ELF"sv, "CHARACTER_RACE_DWARF"sv, "CHARACTER_RACE_GNOME"sv,
+	"CHARACTER_RACE_HOBBIT"sv, "CHARACTER_CLASS_FIGHTER"sv,
+	"CHARACTER_CLASS_MAGE"sv, "CHARACTER_CLASS_PRIEST"sv,
+	"CHARACTER_CLASS_THIEF"sv, "CHARACTER_CLASS_BISHOP"sv,
+	"CHARACTER_CLASS_SAMURAI"sv, "CHARACTER_CLASS_LORD"sv,
+	"CHARACTER_CLASS_NINJA"sv, "LEVEL_LOSS"sv, "LEVEL_GAIN"sv, "LEVEL_DING"sv,
+	"LEVEL_SPELLS"sv, "CHARACTER_STAT_STRENGTH"sv,
+	"CHARACTER_STAT_INTELLIGENCE"sv, "CHARACTER_STAT_PIETY"sv,
+	"CHARACTER_STAT_VITALITY"sv, "CHARACTER_STAT_AGILITY"sv,
+	"CHARACTER_STAT_LUCK"sv, "LEVEL_HP_PREFIX"sv, "LEVEL_HP_SUFFIX"sv,
+	"LEVEL_DIE"sv, "STATUS_POISONED"sv, "STATUS_OK"sv, "STATUS_AFRAID"sv,
+	"STATUS_ASHES"sv, "STATUS_ASLEEP"sv, "STATUS_DEAD"sv, "STATUS_LOST"sv,
+	"STATUS_PARALYSED"sv, "STATUS_SILENCED"sv, "STATUS_STONED"sv,
+	"LOCATION_PARTY"sv, "LOCATION_TAVERN"sv, "LOCATION_TRAINING"sv,
+	"LOCATION_TEMPLE"sv, "LOCATION_MAZE"sv, "STATUS_HIDDEN"sv};
+
+}
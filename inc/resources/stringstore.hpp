@@ -23,24 +23,40 @@
 #pragma once
 
 #include "common/include.hpp"
+#include "common/types.hpp"
 
 namespace Sorcery {
+
+// Strings are read once into a flat table and looked up by a single hash of
+// the key; missing keys never insert anything and are best found up front by
+// calling check() with the keys a resource refers to
 class StringStore {
 
 	public:
 		explicit StringStore(const std::string &filename);
 		StringStore() = delete;
 
-		auto operator[](std::string_view key) -> std::string &;
+		auto operator[](std::string_view key) const -> const std::string &;
 
-		auto get(std::string_view key) -> std::string;
+		auto check(std::string_view source,
+				   std::span<const std::string> keys) const -> unsigned int;
+		auto check(std::string_view source,
+				   std::span<const std::string_view> keys) const
+			-> unsigned int;
+		auto contains(std::string_view key) const -> bool;
+		auto get(std::string_view key) const -> std::string_view;
 		auto reload() -> void;
 
 	private:
+		auto _check(std::string_view source, std::string_view key) const
+			-> bool;
 		auto _load() -> bool;
 
 		std::string _filename;
-		std::map<std::string, std::string, std::less<>> _strings;
+		std::vector<std::string> _values;
+		std::unordered_map<std::string, unsigned int, StringHash,
+						   std::equal_to<>>
+			_index;
 		bool _loaded;
 };
 }
\ No newline at end of file
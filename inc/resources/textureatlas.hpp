@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "common/types.hpp"
+
+namespace Sorcery {
+
+// A single shared texture that small images are packed into, left to right in
+// rows ("shelves"), so that sprite sheets can share one GL texture
+class TextureAtlas {
+
+	public:
+		TextureAtlas(const int width, const int height);
+		~TextureAtlas();
+
+		TextureAtlas(const TextureAtlas &) = delete;
+		auto operator=(const TextureAtlas &) -> TextureAtlas & = delete;
+
+		auto add(const unsigned char *pixels, const int width, const int height)
+			-> std::optional<Rect>;
+		auto bytes() const -> std::size_t;
+		auto get_texture() const -> GLuint;
+		auto get_size() const -> ImVec2;
+
+	private:
+		GLuint _texture;
+		int _width;
+		int _height;
+		int _shelf_x;
+		int _shelf_y;
+		int _shelf_h;
+};
+
+}
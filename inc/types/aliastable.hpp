@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "types/define.hpp"
+
+namespace Sorcery {
+
+// Weighted random choice of an index in constant time, whatever the number of
+// choices, using Walker's alias method: each column holds its own index and
+// one other (its alias), and a draw picks a column and then one of the two.
+// Every draw takes one 64 bit random number
+class AliasTable {
+
+	public:
+		// Constructors
+		AliasTable() = default;
+		explicit AliasTable(std::span<const double> weights);
+
+		// Public Methods
+		auto empty() const -> bool;
+		auto size() const -> unsigned int;
+		auto sample(const std::uint64_t bits) const -> unsigned int;
+
+	private:
+		// Private Members
+		std::vector<std::uint64_t> _thresholds;
+		std::vector<unsigned int> _aliases;
+};
+
+}
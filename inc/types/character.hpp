@@ -36,6 +36,11 @@ namespace Sorcery {
 class System;
 class Resources;
 
+// Per-character tables (spell points are indexed by spell level 1 to 7)
+using Abilities = EnumMap<Enums::Character::Ability, int>;
+using Attributes = EnumMap<Enums::Character::Attribute, int>;
+using SpellPoints = EnumMap<unsigned int, unsigned int, 8>;
+
 class Character {
 
 	public:
@@ -51,14 +56,27 @@ class Character {
 		auto friend operator<<(std::ostream &out_stream,
 							   const Character &character) -> std::ostream &;
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
+		// Serialisation (known spells are still saved as a map of SpellID to
+		// bool so that existing saves can be read)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			const auto spells_known{_get_spells_known_map()};
+			archive(_location, coordinate, depth, _version, _name, _race,
+					_class, _alignment, _start_attr, _cur_attr, _max_attr,
+					_st_points, _portrait_index, _abilities, _priest_max_sp,
+					_priest_cur_sp, _mage_max_sp, _mage_cur_sp, _status,
+					_hidden, spells_known, _legated, inventory,
+					_current_stage);
+		}
+		template <class Archive> auto load(Archive &archive) -> void {
+			EnumMap<Enums::Magic::SpellID, bool> spells_known;
 			archive(_location, coordinate, depth, _version, _name, _race,
 					_class, _alignment, _start_attr, _cur_attr, _max_attr,
 					_st_points, _portrait_index, _abilities, _priest_max_sp,
 					_priest_cur_sp, _mage_max_sp, _mage_cur_sp, _status,
-					_hidden, _spells_known, _legated, inventory,
+					_hidden, spells_known, _legated, inventory,
 					_current_stage);
+			_set_spells_known_map(spells_known);
+			_bump_revision();
 		}
 
 		// Public Methods
@@ -95,10 +113,10 @@ class Character {
 		auto set_class(const Enums::Character::Class &value) -> void;
 		auto get_alignment() const -> Enums::Character::Align;
 		auto set_alignment(const Enums::Character::Align &value) -> void;
-		auto get_cur_attr() const -> std::map<Enums::Character::Attribute, int>;
-		auto get_pos_class() const -> std::map<Enums::Character::Class, bool>;
-		auto get_start_attr() const
-			-> std::map<Enums::Character::Attribute, int>;
+		auto get_cur_attr() const -> const Attributes &;
+		auto get_pos_class() const
+			-> const EnumMap<Enums::Character::Class, bool> &;
+		auto get_start_attr() const -> const Attributes &;
 		auto get_points_left() const -> unsigned int;
 		auto set_points_left(const unsigned int &value) -> void;
 		auto get_start_points() const -> unsigned int;
@@ -116,7 +134,7 @@ class Character {
 		auto set_portrait_index(const unsigned int value) -> void;
 		auto get_spell_points(const Enums::Magic::SpellType type,
 							  const Enums::Magic::SpellPointType status) const
-			-> std::optional<std::map<unsigned int, unsigned int>>;
+			-> std::optional<SpellPoints>;
 		auto get_gold() const -> unsigned int;
 		auto set_gold(const unsigned int value) -> void;
 		auto grant_gold(const int value) -> void;
@@ -124,10 +142,11 @@ class Character {
 		auto get_method() const -> Enums::Manage::Method;
 		auto set_method(const Enums::Manage::Method value) -> void;
 		auto get_summary() -> std::string;
-		auto create_spells() -> void;
-		auto reset_spells() -> void;
+		auto knows_spell(const Enums::Magic::SpellID spell_id) const -> bool;
 		auto replenish_spells() -> void;
-		auto set_spells() -> void;
+		auto recuperate(const unsigned int weekly_cost,
+						const unsigned int hp_per_week,
+						const unsigned int max_weeks) -> unsigned int;
 		auto get_status() const -> Enums::Character::Status;
 		auto get_status_string() const -> std::string;
 		auto get_loc_str() const -> std::string;
@@ -143,6 +162,7 @@ class Character {
 		auto legate(const Enums::Character::Align &value) -> void;
 		auto is_legated() const -> bool;
 		auto get_version() const -> int;
+		auto get_revision() const -> std::uint64_t;
 		auto get_party_panel_text(const int position) -> std::string;
 		auto get_current_hp() const -> int;
 		auto get_max_hp() const -> int;
@@ -165,13 +185,20 @@ class Character {
 		auto get_ress_chance(bool ashes) -> unsigned int;
 		auto damage(const unsigned int adjustment) -> bool;
 		auto heal(const unsigned int adjustment) -> void;
-		auto attributes() -> std::map<Enums::Character::Attribute, int> &;
-		auto abilities() -> std::map<Enums::Character::Ability, int> &;
-		auto spells() -> std::vector<Spell> &;
-		auto priest_cur_sp() -> std::map<unsigned int, unsigned int> &;
-		auto mage_cur_sp() -> std::map<unsigned int, unsigned int> &;
-		auto priest_max_sp() -> std::map<unsigned int, unsigned int> &;
-		auto mage_max_sp() -> std::map<unsigned int, unsigned int> &;
+		// Anything that might be written through changes the revision, so read
+		// through a const Character where possible
+		auto attributes() -> Attributes &;
+		auto attributes() const -> const Attributes &;
+		auto abilities() -> Abilities &;
+		auto abilities() const -> const Abilities &;
+		auto priest_cur_sp() -> SpellPoints &;
+		auto priest_cur_sp() const -> const SpellPoints &;
+		auto mage_cur_sp() -> SpellPoints &;
+		auto mage_cur_sp() const -> const SpellPoints &;
+		auto priest_max_sp() -> SpellPoints &;
+		auto priest_max_sp() const -> const SpellPoints &;
+		auto mage_max_sp() -> SpellPoints &;
+		auto mage_max_sp() const -> const SpellPoints &;
 
 		// Public Members
 		std::optional<Coordinate> coordinate;
@@ -201,7 +228,11 @@ class Character {
 			-> void;
 		auto _set_sp() -> bool;
 		auto _get_spells_known(Enums::Magic::SpellType spell_type,
-							   unsigned int spell_level) -> unsigned int;
+							   unsigned int spell_level) const -> unsigned int;
+		auto _get_spells_known_map() const
+			-> EnumMap<Enums::Magic::SpellID, bool>;
+		auto _set_spells_known_map(
+			const EnumMap<Enums::Magic::SpellID, bool> &spells_known) -> void;
 		auto _get_xp_for_level(unsigned int level) const -> int;
 		auto _get_mage_status(bool current) -> std::string;
 		auto _get_priest_status(bool current) -> std::string;
@@ -215,31 +246,31 @@ class Character {
 			-> bool; // returns true is character is alive, or dead if damage
 					 // was fatal
 		auto _heal(const unsigned int adjustment) -> void;
+		auto _bump_revision() -> void;
 
 		// Private Members
 		int _version;
 
 		System *_system;
 		Resources *_resources;
-		std::map<Enums::Character::Ability, int> _abilities;
-		std::map<unsigned int, unsigned int> _priest_max_sp;
-		std::map<unsigned int, unsigned int> _priest_cur_sp;
-		std::map<unsigned int, unsigned int> _mage_max_sp;
-		std::map<unsigned int, unsigned int> _mage_cur_sp;
-		std::vector<Spell> _spells;
-		std::map<Enums::Magic::SpellID, bool> _spells_known;
+		Abilities _abilities;
+		SpellPoints _priest_max_sp;
+		SpellPoints _priest_cur_sp;
+		SpellPoints _mage_max_sp;
+		SpellPoints _mage_cur_sp;
+		std::bitset<NUM_SPELLS> _spells_known;
 		Enums::Character::Stage _current_stage;
 		std::string _name;
 		Enums::Character::Race _race;
 		Enums::Character::Class _class;
 		Enums::Character::Align _alignment;
-		std::map<Enums::Character::Attribute, int> _start_attr;
-		std::map<Enums::Character::Attribute, int> _cur_attr;
-		std::map<Enums::Character::Attribute, int> _max_attr;
+		Attributes _start_attr;
+		Attributes _cur_attr;
+		Attributes _max_attr;
 		unsigned int _points_left;
 		unsigned int _st_points;
-		std::map<Enums::Character::Class, bool> _pos_classes;
-		std::map<Enums::Character::Class, std::string> _class_list;
+		EnumMap<Enums::Character::Class, bool> _pos_classes;
+		EnumMap<Enums::Character::Class, std::string> _class_list;
 		unsigned int _num_pos_classes;
 		unsigned int _portrait_index;
 		Enums::Character::Status _status;
@@ -247,5 +278,8 @@ class Character {
 		Enums::Manage::Method _method;
 		bool _legated;
 		Enums::Character::Location _location;
+		unsigned int _revision;
+
+		static inline unsigned int s_revision{0};
 };
 }
\ No newline at end of file
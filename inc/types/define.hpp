@@ -32,6 +32,23 @@ using namespace std::literals;
 inline constexpr auto OPT_ON{"on"};
 inline constexpr auto OPT_OFF{"off"};
 
+// Spells (SpellID::DUMAPIC to SpellID::MALIKTO)
+inline constexpr auto NUM_SPELLS{50u};
+
+// Alias tables (a column with this threshold never uses its alias)
+inline constexpr auto ALIAS_ALWAYS{0x100000000ull};
+
+// Inventory slots per character
+inline constexpr auto INVENTORY_SIZE{8u};
+
+// Distinct item names (known, unknown and custom) that can be interned
+inline constexpr auto ITEM_NAME_LIMIT{4096u};
+
+// Game log (messages kept in memory, and how many of those are saved)
+inline constexpr auto LOG_CAPACITY{1000u};
+inline constexpr auto LOG_SAVED_ENTRIES{100u};
+inline constexpr auto LOG_FILE_KEY{"log_file"sv};
+
 // Gameplay settings
 static const int NUM_GAME_SETTINGS{19};
 static const std::string OPT_RECOMMENDED_MODE{"recommended_mode"};
@@ -53,4 +70,8 @@ static const std::string OPT_LOST_LEGATION{"lost_legation"};
 static const std::string OPT_CURABLE_DRAINING{"curable_draining"};
 static const std::string OPT_SHARED_INVENTORY{"shared_inventory"};
 static const std::string OPT_PROTECT_TELEPORT{"protect_teleport"};
+
+// Skip the real-time wait when resting at the Inn or healing at the Temple
+// (not one of the game settings above, so read directly from the config)
+inline constexpr auto FAST_FORWARD_KEY{"fast_forward"sv};
 }
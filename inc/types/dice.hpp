@@ -43,6 +43,7 @@ class Dice {
 		auto set(const unsigned int num_, const unsigned int dice_,
 				 const int mod_);
 		auto str() const -> std::string;
+		static auto seed(const std::uint64_t value) -> void;
 
 		// Public Members
 		unsigned int num;
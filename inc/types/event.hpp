@@ -0,0 +1,154 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/enum.hpp"
+#include "common/include.hpp"
+
+namespace Sorcery {
+
+using namespace std::literals;
+
+// Everything fixed about a type of special dungeon event, shared by every level
+// and every game: the name used in the map metadata, the layout component and
+// what happens afterwards, and the string keys of the message shown
+struct EventDescriptor {
+		Enums::Map::Event event;
+		std::string_view name;
+		std::string_view component_key;
+		bool search_after;
+		bool combat_after;
+		bool go_back_after;
+		bool go_town_after;
+		std::span<const std::string_view> messages;
+};
+
+// Message string keys
+inline constexpr std::array EVENT_MESSAGES_AREA_OUT_OF_BOUNDS{
+	"GAME_MESSAGE_AREA_OUT_OF_BOUNDS_1"sv,
+	"GAME_MESSAGE_AREA_OUT_OF_BOUNDS_2"sv};
+inline constexpr std::array EVENT_MESSAGES_MAN_TELEPORT_CASTLE{
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_1"sv,
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_2"sv,
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_3"sv,
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_4"sv,
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_5"sv,
+	"GAME_MESSAGE_MAN_TELEPORT_CASTLE_6"sv};
+inline constexpr std::array EVENT_MESSAGES_SILVER_KEY{
+	"GAME_MESSAGE_SILVER_KEY_1"sv, "GAME_MESSAGE_SILVER_KEY_2"sv,
+	"GAME_MESSAGE_SILVER_KEY_3"sv, "GAME_MESSAGE_SILVER_KEY_4"sv,
+	"GAME_MESSAGE_SILVER_KEY_5"sv, "GAME_MESSAGE_SILVER_KEY_6"sv,
+	"GAME_MESSAGE_SILVER_KEY_7"sv, "GAME_MESSAGE_SILVER_KEY_8"sv};
+inline constexpr std::array EVENT_MESSAGES_BRONZE_KEY{
+	"GAME_MESSAGE_BRONZE_KEY_1"sv, "GAME_MESSAGE_BRONZE_KEY_2"sv,
+	"GAME_MESSAGE_BRONZE_KEY_3"sv, "GAME_MESSAGE_BRONZE_KEY_4"sv,
+	"GAME_MESSAGE_BRONZE_KEY_5"sv, "GAME_MESSAGE_BRONZE_KEY_6"sv};
+inline constexpr std::array EVENT_MESSAGES_MURPHYS_GHOSTS{
+	"GAME_MESSAGE_MURPHYS_GHOSTS_1"sv, "GAME_MESSAGE_MURPHYS_GHOSTS_2"sv,
+	"GAME_MESSAGE_MURPHYS_GHOSTS_3"sv, "GAME_MESSAGE_MURPHYS_GHOSTS_4"sv,
+	"GAME_MESSAGE_MURPHYS_GHOSTS_5"sv};
+inline constexpr std::array EVENT_MESSAGES_BEAR_STATUE{
+	"GAME_MESSAGE_BEAR_STATUE_1"sv, "GAME_MESSAGE_BEAR_STATUE_2"sv,
+	"GAME_MESSAGE_BEAR_STATUE_3"sv};
+inline constexpr std::array EVENT_MESSAGES_FROG_STATUE{
+	"GAME_MESSAGE_FROG_STATUE_1"sv, "GAME_MESSAGE_FROG_STATUE_2"sv,
+	"GAME_MESSAGE_FROG_STATUE_3"sv, "GAME_MESSAGE_FROG_STATUE_4"sv};
+inline constexpr std::array EVENT_MESSAGES_GOLD_KEY{
+	"GAME_MESSAGE_GOLD_KEY_1"sv, "GAME_MESSAGE_GOLD_KEY_2"sv,
+	"GAME_MESSAGE_GOLD_KEY_3"sv, "GAME_MESSAGE_GOLD_KEY_4"sv,
+	"GAME_MESSAGE_GOLD_KEY_5"sv, "GAME_MESSAGE_GOLD_KEY_6"sv};
+
+// One entry per event (not including NO_EVENT) in the order of
+// Enums::Map::Event - bools are search after, encounter after, go back a
+// square after, and teleport back to town
+inline constexpr auto NUM_EVENTS{
+	static_cast<unsigned int>(magic_enum::enum_count<Enums::Map::Event>() - 1)};
+inline constexpr std::array<EventDescriptor, NUM_EVENTS> EVENTS{{
+	// clang-format off
+	{Enums::Map::Event::AREA_OF_OUT_BOUNDS, "AREA_OUT_OF_BOUNDS", "event_area_out_of_bounds", false, false, false, false, EVENT_MESSAGES_AREA_OUT_OF_BOUNDS},
+	{Enums::Map::Event::MAN_TELEPORT_CASTLE, "MAN_TELEPORT_CASTLE", "event_man_teleport_castle", false, false, false, true, EVENT_MESSAGES_MAN_TELEPORT_CASTLE},
+	{Enums::Map::Event::SILVER_KEY, "SILVER_KEY", "event_silver_key", true, false, false, false, EVENT_MESSAGES_SILVER_KEY},
+	{Enums::Map::Event::BRONZE_KEY, "BRONZE_KEY", "event_bronze_key", true, false, false, false, EVENT_MESSAGES_BRONZE_KEY},
+	{Enums::Map::Event::MURPHYS_GHOSTS, "MURPHYS_GHOSTS", "event_murphys_ghosts", true, true, false, false, EVENT_MESSAGES_MURPHYS_GHOSTS},
+	{Enums::Map::Event::BEAR_STATUE, "BEAR_STATUE", "event_bear_statue", true, false, false, false, EVENT_MESSAGES_BEAR_STATUE},
+	{Enums::Map::Event::FROG_STATUE, "FROG_STATUE", "event_frog_statue", true, false, false, false, EVENT_MESSAGES_FROG_STATUE},
+	{Enums::Map::Event::GOLD_KEY, "GOLD_KEY", "event_gold_key", true, false, false, false, EVENT_MESSAGES_GOLD_KEY},
+	{Enums::Map::Event::NEED_SILVER_KEY, "NEED_SILVER_KEY", "event_need_silver_key", false, false, true, false, {}},
+	{Enums::Map::Event::NEED_BRONZE_KEY, "NEED_BRONZE_KEY", "event_need_bronze_key", false, false, true, false, {}},
+	{Enums::Map::Event::NEED_BEAR_STATUE, "NEED_BEAR_STATUE", "event_cannot_break_doors_down", false, false, true, false, {}},
+	{Enums::Map::Event::NEED_FROG_STATUE, "NEED_FROG_STATUE", "event_cannot_break_doors_down", false, false, true, false, {}},
+	{Enums::Map::Event::PLACARD_PIT_1, "PLACARD_PIT_1", "event_placard_pit_1", false, false, false, false, {}},
+	{Enums::Map::Event::PLACARD_PIT_2, "PLACARD_PIT_2", "event_placard_pit_2", false, false, false, false, {}},
+	{Enums::Map::Event::PLACARD_PIT_3, "PLACARD_PIT_3", "event_placard_pit_3", false, false, false, false, {}},
+	{Enums::Map::Event::TURN_AROUND, "TURN_AROUND", "event_turn_around", false, false, false, false, {}},
+	{Enums::Map::Event::TURN_LEFT, "TURN_LEFT", "event_turn_left", false, false, false, false, {}},
+	{Enums::Map::Event::TURN_RIGHT, "TURN_RIGHT", "event_turn_right", false, false, false, false, {}},
+	{Enums::Map::Event::NEED_BEAR_STATUE_2, "NEED_BEAR_STATUE_2", "event_need_bear_statue_2", false, false, true, false, {}},
+	{Enums::Map::Event::TESTING_GROUNDS, "TESTING_GROUNDS", "event_testing_grounds", false, false, false, false, {}},
+	{Enums::Map::Event::ALARM_BELLS, "ALARM_BELLS", "event_alarm_bells", false, true, false, false, {}},
+	{Enums::Map::Event::TREASURE_REPOSITORY, "TREASURE_REPOSITORY", "event_treasure_repository", false, false, false, false, {}},
+	{Enums::Map::Event::MONSTER_ALLOCATION_CENTRE, "MONSTER_ALLOCATION_CENTRE", "event_monster_allocation_centre", false, false, false, false, {}},
+	{Enums::Map::Event::LARGE_DESK, "LARGE_DESK", "event_large_desk", false, false, false, false, {}},
+	{Enums::Map::Event::TREBOR_VOICE, "TREBOR_VOICE", "event_trebor_voice", false, false, false, false, {}},
+	{Enums::Map::Event::SERVICE_ELEVATOR, "SERVICE_ELEVATOR", "event_service_elevator", false, false, false, false, {}},
+	{Enums::Map::Event::WERDNA_BOAST, "WERDNA_BOAST", "event_werdna_boast", false, false, false, false, {}},
+	{Enums::Map::Event::TURN_BACK, "TURN_BACK", "event_turn_back", false, false, false, false, {}},
+	{Enums::Map::Event::WERDNA_SIGN, "WERDNA_SIGN", "event_werdna_sign_1", false, false, false, false, {}},
+	{Enums::Map::Event::THREE_HUMANOIDS, "THREE_HUMANOIDS", "event_three_humanoids", false, false, false, false, {}},
+	{Enums::Map::Event::GETTING_WARM_1, "GETTING_WARM_1", "event_getting_warm_1", false, false, false, false, {}},
+	{Enums::Map::Event::GETTING_WARM_2, "GETTING_WARM_2", "event_getting_warm_2", false, false, false, false, {}},
+	{Enums::Map::Event::GETTING_WARM_3, "GETTING_WARM_3", "event_getting_warm_3", false, false, false, false, {}},
+	{Enums::Map::Event::FIRE_DRAGONS_COMBAT, "FIRE_DRAGONS_COMBAT", "event_fire_dragons_combat", false, true, false, false, {}},
+	{Enums::Map::Event::DEADLY_RING_COMBAT, "DEADLY_RING_COMBAT", "event_deadly_ring_combat", false, true, false, false, {}},
+	{Enums::Map::Event::WERDNA_COMBAT, "WERDNA_COMBAT", "event_werdna_combat", false, true, false, false, {}},
+	{Enums::Map::Event::GUARANTEED_COMBAT, "GUARANTEED_COMBAT", "event_guaranteed_combat", false, true, false, false, {}},
+	{Enums::Map::Event::NEED_BLUE_RIBBON, "NEED_BLUE_RIBBON", "event_need_blue_ribbon", false, false, true, false, {}},
+	// clang-format on
+}};
+
+static_assert(std::ranges::all_of(std::views::iota(0u, NUM_EVENTS),
+								  [](const auto i) {
+									  return static_cast<unsigned int>(
+												 EVENTS[i].event) == i;
+								  }),
+			  "EVENTS must be in the same order as Enums::Map::Event");
+
+// Always assumes that event isn't NO_EVENT
+constexpr auto get_event_descriptor(const Enums::Map::Event event)
+	-> const EventDescriptor & {
+
+	return EVENTS[static_cast<std::size_t>(event)];
+}
+
+// Only used when loading maps, so a search is fine
+constexpr auto find_event(std::string_view name)
+	-> std::optional<Enums::Map::Event> {
+
+	const auto it{std::ranges::find(EVENTS, name, &EventDescriptor::name)};
+	if (it == EVENTS.end())
+		return std::nullopt;
+
+	return it->event;
+}
+
+}
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "types/character.hpp"
+#include "types/event.hpp"
 
 namespace Sorcery {
 
@@ -67,7 +68,14 @@ class Game {
 		auto get_console_status() const -> bool;
 		auto has_party_in_maze() const -> bool;
 		auto get_party_alignment() const -> Enums::Character::Align;
-		auto get_characters_at_loc() const -> std::vector<unsigned int>;
+		auto get_characters_at_loc() const -> std::span<const unsigned int>;
+		auto get_characters_at(const int depth, const Coordinate loc) const
+			-> std::span<const unsigned int>;
+		auto get_characters_on_level(const int depth) const
+			-> std::vector<unsigned int>;
+		auto set_character_location(const unsigned int char_id,
+									const Enums::Character::Location location)
+			-> void;
 		auto pass_turn(unsigned int turns = 1) -> void;
 		auto get_turns() const -> unsigned int;
 		auto divvy_party_gold() -> void;
@@ -75,7 +83,8 @@ class Game {
 		auto pool_party_gold(unsigned int char_id) -> void;
 		auto log(const std::string &message, const int dice = -1,
 				 const int roll = -1, const int needed = -1) -> void;
-		auto get_event(Enums::Map::Event event_type) const -> DungeonEvent;
+		auto get_event(Enums::Map::Event event_type) const
+			-> const DungeonEvent &;
 		auto enable_event(Enums::Map::Event event_type) -> void;
 		auto disable_event(Enums::Map::Event event_type) -> void;
 		auto print() -> void;
@@ -92,6 +101,9 @@ class Game {
 		auto _get_characters() -> std::map<unsigned int, Character>;
 		auto _save_characters() -> void;
 		auto _update_party_location() -> void;
+		auto _index_characters() -> void;
+		auto _index_character(const unsigned int char_id) -> void;
+		auto _unindex_character(const unsigned int char_id) -> void;
 		auto _set_up_dungeon_events() -> void;
 		auto _set_up_debug_keys() -> void;
 
@@ -115,7 +127,10 @@ class Game {
 		std::string _status;
 		std::vector<unsigned int> _char_ids;
 		bool _show_console;
-		std::vector<DungeonEvent> _events;
+		std::array<DungeonEvent, NUM_EVENTS> _events;
+
+		// Characters left in the maze, by depth and then by square
+		std::map<int, std::map<Coordinate, std::vector<unsigned int>>> _in_maze;
 		std::map<SDL_Keycode, std::function<void()>> _debug;
 };
 
@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include "common/include.hpp"
+#include "common/types.hpp"
+#include "types/define.hpp"
+
+namespace Sorcery {
+
+// The game log, as a fixed capacity ring buffer: once full, adding a message
+// overwrites the oldest one (which is also written to the spill file first, if
+// one has been set, so that the full history can still be kept)
+class GameLog {
+
+	public:
+		// A message with its line of text already formatted for display; the
+		// strings in each slot keep their capacity as they are reused
+		struct Entry {
+				long int id;
+				Enums::Internal::MessageType type;
+				std::chrono::time_point<std::chrono::system_clock> datetime;
+				std::string text;
+				std::string line;
+		};
+
+		GameLog(const std::size_t capacity = LOG_CAPACITY);
+
+		auto operator[](const std::size_t index) const -> const Entry &;
+
+		auto add(const Enums::Internal::MessageType type,
+				 std::string_view text) -> void;
+		auto add(const ConsoleMessage &message) -> void;
+		auto clear() -> void;
+		auto empty() const -> bool;
+		auto get_last(std::size_t count) const -> std::vector<ConsoleMessage>;
+		auto set_spill_file(const std::filesystem::path &path) -> void;
+		auto size() const -> std::size_t;
+
+	private:
+		std::vector<Entry> _entries;
+		std::size_t _head;
+		std::size_t _size;
+		long int _next_id;
+		std::ofstream _spill;
+
+		auto _add(const Enums::Internal::MessageType type,
+				  const std::chrono::time_point<std::chrono::system_clock> tp,
+				  std::string_view text) -> void;
+};
+
+}
@@ -34,10 +34,20 @@ class Image {
 
 		auto operator<=>(const Image &a) const;
 
+		auto uv(const ImVec2 local) const -> ImVec2;
+
 		std::string key;
 		GLuint texture;
 		int width;
 		int height;
+
+		// Where the image sits inside its texture (0-1 unless atlased)
+		ImVec2 uv_min;
+		ImVec2 uv_max;
+		bool atlased;
+		bool resident;
+		std::size_t bytes;
+		std::uint64_t last_frame;
 };
 
 }
\ No newline at end of file
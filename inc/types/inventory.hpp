@@ -35,6 +35,7 @@ namespace Sorcery {
 // Forward Declarations
 class ItemType;
 
+// Items are held inline in a fixed number of slots; slots are 1-indexed
 class Inventory {
 
 	public:
@@ -49,9 +50,13 @@ class Inventory {
 		auto friend operator<<(std::ostream &out_stream,
 							   const Inventory &inventory) -> std::ostream &;
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
-			archive(_items);
+		// Serialisation (in the same form as the std::vector<Item> used to be)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			archive(Slots<const Inventory>{this});
+		}
+
+		template <class Archive> auto load(Archive &archive) -> void {
+			archive(Slots<Inventory>{this});
 		}
 
 		// Public Methods
@@ -60,13 +65,14 @@ class Inventory {
 		auto is_full() const -> bool;
 		auto is_empty() const -> bool;
 		auto get_empty_slots() const -> unsigned int;
-		auto add(Item item) -> void;
+		auto get_revision() const -> unsigned int;
+		auto add(const Item &item) -> bool;
 		auto add_type(const ItemType &item_type) -> bool;
 		auto add_type(const ItemType &item_type, const bool known) -> bool;
 		auto add_type(const ItemType &item_type, const bool usable,
 					  const bool known) -> bool;
 		auto unequip_all() -> void;
-		auto items() const -> std::vector<Item>;
+		auto items() const -> std::span<const Item>;
 		auto has_unidentified_items() const -> bool;
 		auto has_cursed_items() const -> bool;
 		auto has_cursed_equipped_item_category(
@@ -79,7 +85,7 @@ class Inventory {
 						   const unsigned int id_chance,
 						   const unsigned int curse_chance)
 			-> Enums::Items::IdentifyOutcome;
-		auto get(const unsigned int slot) -> Item;
+		auto get(const unsigned int slot) const -> const Item &;
 		auto has(const unsigned int slot) const -> bool;
 
 		auto unequip_item(const unsigned int slot) -> bool;
@@ -88,7 +94,34 @@ class Inventory {
 		auto use_item(const unsigned int slot) -> bool;
 
 	private:
+		// Wraps the slots so they serialise as a sized sequence
+		template <typename T> struct Slots {
+				T *inventory;
+
+				template <class Archive>
+				auto save(Archive &archive) const -> void {
+					archive(cereal::make_size_tag(
+						static_cast<cereal::size_type>(inventory->_count)));
+					for (const auto &item : inventory->items())
+						archive(item);
+				}
+
+				template <class Archive> auto load(Archive &archive) -> void {
+					cereal::size_type count{};
+					archive(cereal::make_size_tag(count));
+					inventory->clear();
+					for (auto i = 0u; i < count; i++) {
+						Item item{};
+						archive(item);
+						inventory->add(item);
+					}
+				}
+		};
+
 		// Private Methods
+		auto _valid(const unsigned int slot) const -> bool;
+		auto _erase(const unsigned int slot) -> void;
+		auto _bump_revision() -> void;
 		auto
 		_has_equipped_item_category(const Enums::Items::Category category) const
 			-> bool;
@@ -98,7 +131,11 @@ class Inventory {
 			-> bool;
 
 		// Private Members
-		std::vector<Item> _items;
+		std::array<Item, INVENTORY_SIZE> _items;
+		std::uint8_t _count;
+		unsigned int _revision;
+
+		static inline unsigned int s_revision{0};
 };
 
 }
@@ -29,6 +29,9 @@ namespace Sorcery {
 
 class ItemType;
 
+// Items are small trivially-copyable records (a type, a category and flag
+// bits), so inventories can hold them inline. Names are interned, as there
+// are only ever a handful of distinct ones
 class Item {
 
 	public:
@@ -37,17 +40,31 @@ class Item {
 		Item(const ItemType &item_type);
 		Item(const ItemType &item_type, const bool usable);
 
-		// Copy Constructor
-		Item(const Item &item);
-
 		// Overloaded Operators
 		auto friend operator<<(std::ostream &out_stream, const Item &item)
 			-> std::ostream &;
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
-			archive(_type, _category, _known, _equipped, _cursed, _marked,
-					_usable, _name, _id, s_id);
+		// Serialisation (the unused values were a per-item id and counter)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			const long id{0};
+			archive(_type, _category, get_known(), get_equipped(),
+					get_cursed(), get_marked(), get_usable(),
+					_get_interned(_name), id, id);
+		}
+
+		template <class Archive> auto load(Archive &archive) -> void {
+			bool known{}, equipped{}, cursed{}, marked{}, usable{};
+			std::string name{};
+			long id{};
+			archive(_type, _category, known, equipped, cursed, marked, usable,
+					name, id, id);
+			_flags = 0;
+			_set_flag(KNOWN, known);
+			_set_flag(EQUIPPED, equipped);
+			_set_flag(CURSED, cursed);
+			_set_flag(MARKED, marked);
+			_set_flag(USABLE, usable);
+			_name = _intern(name);
 		}
 
 		// Public Methods
@@ -57,30 +74,40 @@ class Item {
 		auto get_equipped() const -> bool;
 		auto get_cursed() const -> bool;
 		auto get_marked() const -> bool;
-		auto get_name() const -> std::string;
+		auto get_name() const -> std::string_view;
 		auto set_known(const bool value) -> void;
 		auto set_equipped(const bool value) -> void;
 		auto set_cursed(const bool value) -> void;
 		auto set_marked(const bool value) -> void;
-		auto set_name(const std::string &value) -> void;
+		auto set_name(std::string_view value) -> void;
 		auto decay_to(const Enums::Items::TypeID value) -> void;
 		auto set_usable(const bool value) -> void;
 		auto get_usable() const -> bool;
-		auto get_display_name() const -> std::string;
+		auto get_display_name() const -> std::string_view;
 
 	private:
+		// Private Methods
+		auto _get_flag(const std::uint8_t flag) const -> bool;
+		auto _set_flag(const std::uint8_t flag, const bool value) -> void;
+		static auto _intern(std::string_view name) -> std::uint16_t;
+		static auto _get_interned(const std::uint16_t id)
+			-> const std::string &;
+
+		// Flag Bits
+		static constexpr std::uint8_t KNOWN{1 << 0};
+		static constexpr std::uint8_t EQUIPPED{1 << 1};
+		static constexpr std::uint8_t CURSED{1 << 2};
+		static constexpr std::uint8_t MARKED{1 << 3}; // Undroppable/unsellable
+		static constexpr std::uint8_t USABLE{1 << 4};
+
+		// Private Members
 		Enums::Items::TypeID _type;		  // Type
 		Enums::Items::Category _category; // Category
-		bool _known;					  // Is known
-		bool _equipped;					  // Is currently equipped
-		bool _cursed;					  // Is currently cursed
-		bool _marked;					  // Marked as undroppable or unsellable
-		bool _usable;					  // Is usable
-		std::string _name; // Individual Name (or if not set, the ITT Name)
-		std::string _uname;
-
-		long _id;
-		static inline long s_id{0};
+		std::uint8_t _flags;			  // Flag Bits
+		std::uint16_t _name;  // Individual Name (or if not set, the ITT Name)
+		std::uint16_t _uname; // Name when unidentified
 };
 
+static_assert(std::is_trivially_copyable_v<Item>);
+
 }
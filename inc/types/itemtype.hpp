@@ -118,6 +118,7 @@ class ItemType {
 		auto get_usage() const -> std::string;
 		auto set_invokage(const std::string value) -> void;
 		auto get_invokage() const -> std::string;
+		static auto seed(const std::uint64_t value) -> void;
 
 	private:
 		// Private Members
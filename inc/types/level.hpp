@@ -85,7 +85,6 @@ class Level {
 		Coordinate _bottom_left;
 		Size _size;
 		std::map<Coordinate, Tile> _tiles;
-		std::map<std::string, Enums::Map::Event> _event_mappings;
 
 		// Private Methods
 		auto _add_tile(const Coordinate location) -> void;
@@ -114,7 +113,6 @@ class Level {
 								  const unsigned int terrain) -> void;
 		auto _map_event_types(const std::string &string) const
 			-> std::optional<Enums::Map::Event>;
-		auto _add_event_mappings() -> void;
 };
 
 }
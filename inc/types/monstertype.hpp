@@ -104,6 +104,7 @@ class MonsterType {
 		auto has_resistance(Enums::Monsters::Resistance value) -> bool;
 		auto has_property(Enums::Monsters::Property value) -> bool;
 		auto clear_attacks() -> void;
+		static auto seed(const std::uint64_t value) -> void;
 
 	private:
 		// Private Members
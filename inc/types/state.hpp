@@ -28,6 +28,7 @@
 #include "core/include.hpp"
 #include "types/enum.hpp"
 #include "types/explore.hpp"
+#include "types/gamelog.hpp"
 #include "types/level.hpp"
 
 namespace Sorcery {
@@ -44,11 +45,21 @@ class State {
 		State();
 		State(System *system);
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
+		// Serialisation (only the most recent log messages are saved)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			const auto log{_log.get_last(LOG_SAVED_ENTRIES)};
 			archive(_version, _party, level, explored, _player_depth,
 					_previous_depth, _player_pos, _previous_pos,
-					_playing_facing, _lit, _turns, _log, _shop);
+					_playing_facing, _lit, _turns, log, _shop);
+		}
+		template <class Archive> auto load(Archive &archive) -> void {
+			std::vector<ConsoleMessage> log;
+			archive(_version, _party, level, explored, _player_depth,
+					_previous_depth, _player_pos, _previous_pos,
+					_playing_facing, _lit, _turns, log, _shop);
+			_log.clear();
+			for (const auto &message : log)
+				_log.add(message);
 		}
 
 		// Public Members
@@ -98,8 +109,7 @@ class State {
 		auto add_log_dice_roll(const std::string &message, const int dice = -1,
 							   const int roll = -1, const int needed = -1)
 			-> void;
-		auto get_log_messages(unsigned int last = 0) const
-			-> std::vector<ConsoleMessage>;
+		auto get_log() const -> const GameLog &;
 		auto print() -> void;
 		auto check_shop_stock(const Enums::Items::TypeID item_type) const
 			-> int;
@@ -122,6 +132,7 @@ class State {
 		auto _clear() -> void;
 		auto _clear_explored() -> void;
 		auto _restart_expedition() -> void;
+		auto _set_log_file() -> void;
 
 		// Private Members
 		System *_system;
@@ -134,7 +145,7 @@ class State {
 		bool _lit;
 		int _version;
 		unsigned int _turns;
-		std::vector<ConsoleMessage> _log;
+		GameLog _log;
 		std::array<ShopStock, 101> _shop; // Max ItemID + 1 as its 0-indexed
 };
 }
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "common/include.hpp"
+#include "core/resources.hpp"
+#include "core/system.hpp"
+#include "engine/simulator.hpp"
+
+namespace {
+
+inline constexpr auto DEPTH_PARAM{"--depth="sv};
+inline constexpr auto LEVEL_PARAM{"--level="sv};
+inline constexpr auto ENCOUNTERS_PARAM{"--encounters="sv};
+inline constexpr auto PARTIES_PARAM{"--parties="sv};
+inline constexpr auto THREADS_PARAM{"--threads="sv};
+inline constexpr auto SEED_PARAM{"--seed="sv};
+inline constexpr auto HELP_PARAM{"--help"sv};
+
+auto usage() -> void {
+
+	std::println("Usage: sorcery_sim [options]");
+	std::println("  --depth=<n>[-<m>]  Dungeon depth, or range of depths (1)");
+	std::println("  --level=<n>        Level of the party (1)");
+	std::println("  --encounters=<n>   Encounters per depth (10000)");
+	std::println("  --parties=<n>      Parties to take turns fighting (16)");
+	std::println("  --threads=<n>      Worker threads, 0 for one per core (0)");
+	std::println("  --seed=<n>         RNG seed (1)");
+}
+
+template <typename T> auto parse(std::string_view text, T &value) -> bool {
+
+	const auto [ptr, ec]{
+		std::from_chars(text.data(), text.data() + text.size(), value)};
+
+	return ec == std::errc{} && ptr == text.data() + text.size();
+}
+
+} // namespace
+
+// Simulates encounters at each depth asked for and prints a line per depth
+auto main(int argc, char *argv[]) -> int {
+
+	Sorcery::SimulationConfig config{1, 1, 10000, 16, 0, 1};
+	auto last_depth{1};
+	for (const std::string_view arg : std::span(argv + 1, argv + argc)) {
+		auto valid{false};
+		if (arg == HELP_PARAM) {
+			usage();
+			return EXIT_SUCCESS;
+		} else if (arg.starts_with(DEPTH_PARAM)) {
+			const auto value{arg.substr(DEPTH_PARAM.size())};
+			const auto dash{value.find('-')};
+			valid = parse(value.substr(0, dash), config.depth) &&
+					(dash == std::string_view::npos
+						 ? parse(value, last_depth)
+						 : parse(value.substr(dash + 1), last_depth));
+		} else if (arg.starts_with(LEVEL_PARAM))
+			valid = parse(arg.substr(LEVEL_PARAM.size()), config.level);
+		else if (arg.starts_with(ENCOUNTERS_PARAM))
+			valid =
+				parse(arg.substr(ENCOUNTERS_PARAM.size()), config.encounters);
+		else if (arg.starts_with(PARTIES_PARAM))
+			valid = parse(arg.substr(PARTIES_PARAM.size()), config.parties);
+		else if (arg.starts_with(THREADS_PARAM))
+			valid = parse(arg.substr(THREADS_PARAM.size()), config.threads);
+		else if (arg.starts_with(SEED_PARAM))
+			valid = parse(arg.substr(SEED_PARAM.size()), config.seed);
+
+		if (!valid) {
+			std::cerr << std::format("Invalid option '{}'!", arg) << std::endl;
+			usage();
+			return EXIT_FAILURE;
+		}
+	}
+	if (config.depth < 1 || last_depth < config.depth || config.level < 1 ||
+		config.parties < 1) {
+		std::cerr << "Depths, level and parties must be at least 1!"
+				  << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	auto system{std::make_unique<Sorcery::System>(0, nullptr)};
+	auto resources{std::make_unique<Sorcery::Resources>(system.get())};
+
+	std::println("{:>5} {:>5} {:>7} {:>7} {:>8} {:>9} {:>8} {:>10} {:>8}",
+				 "Depth", "Types", "Win %", "Rounds", "HP Lost", "XP", "Gold",
+				 "Enc/s", "Threads");
+	for (auto depth = config.depth; depth <= last_depth; depth++) {
+		auto depth_config{config};
+		depth_config.depth = depth;
+		Sorcery::Simulator simulator{system.get(), resources.get(),
+									 depth_config};
+		const auto result{simulator.run()};
+		const auto &totals{result.totals};
+		if (totals.encounters == 0) {
+			std::println("{:>5} {:>5} (no monsters)", depth,
+						 simulator.get_monster_types().size());
+			continue;
+		}
+
+		const auto count{static_cast<double>(totals.encounters)};
+		const auto seconds{
+			std::chrono::duration<double>(result.elapsed).count()};
+		std::println(
+			"{:>5} {:>5} {:>7.1f} {:>7.2f} {:>8.1f} {:>9.1f} {:>8.1f} "
+			"{:>10.0f} {:>8}",
+			depth, simulator.get_monster_types().size(),
+			100.0 * static_cast<double>(totals.wins) / count,
+			static_cast<double>(totals.rounds) / count,
+			static_cast<double>(totals.hp_lost) / count,
+			static_cast<double>(totals.xp) / count,
+			static_cast<double>(totals.gold) / count,
+			seconds > 0.0 ? count / seconds : 0.0, result.threads);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,227 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/allocations.hpp"
+#include "types/error.hpp"
+
+namespace {
+
+// Only ever incremented, so relaxed ordering is enough
+std::atomic<std::uint64_t> total_count{0};
+std::atomic<std::uint64_t> total_bytes{0};
+thread_local std::uint64_t thread_count{0};
+thread_local std::uint64_t thread_bytes{0};
+
+// Frame budget (only used on the main thread)
+std::optional<std::uint64_t> budget{std::nullopt};
+std::string budget_screen{};
+std::optional<Sorcery::AllocationCount> last_frame{std::nullopt};
+std::string last_screen{};
+
+#ifdef SORCERY_TRACK_ALLOCATIONS
+auto record(const std::size_t size) -> void {
+
+	total_count.fetch_add(1, std::memory_order_relaxed);
+	total_bytes.fetch_add(size, std::memory_order_relaxed);
+	++thread_count;
+	thread_bytes += size;
+}
+
+auto allocate(std::size_t size) -> void * {
+
+	record(size);
+	if (auto ptr{std::malloc(size == 0 ? 1 : size)}; ptr != nullptr)
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+auto allocate(std::size_t size, const std::align_val_t align) -> void * {
+
+	// aligned_alloc needs the size to be a multiple of the alignment
+	record(size);
+	const auto alignment{static_cast<std::size_t>(align)};
+	size = std::max((size + alignment - 1) / alignment * alignment, alignment);
+	if (auto ptr{std::aligned_alloc(alignment, size)}; ptr != nullptr)
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+#endif
+
+} // namespace
+
+#ifdef SORCERY_TRACK_ALLOCATIONS
+auto operator new(std::size_t size) -> void * {
+
+	return allocate(size);
+}
+
+auto operator new[](std::size_t size) -> void * {
+
+	return allocate(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t align) -> void * {
+
+	return allocate(size, align);
+}
+
+auto operator new[](std::size_t size, std::align_val_t align) -> void * {
+
+	return allocate(size, align);
+}
+
+auto operator new(std::size_t size, const std::nothrow_t &) noexcept
+	-> void * {
+
+	try {
+		return allocate(size);
+	} catch (std::bad_alloc &) {
+		return nullptr;
+	}
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t &) noexcept
+	-> void * {
+
+	try {
+		return allocate(size);
+	} catch (std::bad_alloc &) {
+		return nullptr;
+	}
+}
+
+auto operator delete(void *ptr) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete[](void *ptr) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::size_t) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete[](void *ptr, std::size_t) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::align_val_t) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete[](void *ptr, std::align_val_t) noexcept -> void {
+
+	std::free(ptr);
+}
+
+auto operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+	-> void {
+
+	std::free(ptr);
+}
+
+auto operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+	-> void {
+
+	std::free(ptr);
+}
+#endif
+
+auto Sorcery::Allocations::is_tracking() -> bool {
+
+#ifdef SORCERY_TRACK_ALLOCATIONS
+	return true;
+#else
+	return false;
+#endif
+}
+
+auto Sorcery::Allocations::get_total() -> AllocationCount {
+
+	return AllocationCount{total_count.load(std::memory_order_relaxed),
+						   total_bytes.load(std::memory_order_relaxed)};
+}
+
+// Cheap enough to call at the start and end of every profiling scope
+auto Sorcery::Allocations::get_thread() -> AllocationCount {
+
+	return AllocationCount{thread_count, thread_bytes};
+}
+
+// Either a count for every screen, or "<screen>:<count>" for just the one
+auto Sorcery::Allocations::set_budget(std::string_view value) -> bool {
+
+	const auto split{value.rfind(':')};
+	const auto count{split == std::string_view::npos ? value
+													 : value.substr(split + 1)};
+	std::uint64_t parsed{0};
+	if (const auto [ptr, ec]{std::from_chars(
+			count.data(), count.data() + count.size(), parsed)};
+		ec != std::errc{} || ptr != count.data() + count.size())
+		return false;
+
+	budget = parsed;
+	budget_screen = split == std::string_view::npos
+						? std::string{}
+						: std::string{value.substr(0, split)};
+
+	return true;
+}
+
+// Called once a frame on the main thread; counts are since the previous call
+// and include every thread. The first frame of each screen is not counted, as
+// it includes setting the screen up. Exits if the screen is over its budget
+auto Sorcery::Allocations::check_frame(std::string_view screen) -> void {
+
+	if (!is_tracking() || !budget)
+		return;
+
+	const auto total{get_total()};
+	const auto previous{last_frame};
+	last_frame = total;
+	if (screen != last_screen) {
+		last_screen = screen;
+		return;
+	}
+	if (!previous || (!budget_screen.empty() && screen != budget_screen))
+		return;
+
+	if (const auto count{total.count - previous->count};
+		count > budget.value()) {
+		std::runtime_error exception{"allocation budget exceeded"};
+		Error error{Enums::System::Error::ALLOCATION_BUDGET_EXCEEDED, exception,
+					std::format("Screen '{}' made {} allocations ({} bytes) in "
+								"one frame, over the budget of {}!",
+								screen, count, total.bytes - previous->bytes,
+								budget.value())};
+		std::cerr << error;
+		exit(EXIT_FAILURE);
+	}
+}
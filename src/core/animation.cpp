@@ -22,6 +22,7 @@
 
 #include "core/animation.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 
 // Standard Constructor
 Sorcery::Animation::Animation(Random *random)
@@ -140,6 +141,7 @@ auto Sorcery::Animation::_change_wp(bool force) -> void {
 		_do_wp();
 	else {
 
+		Trace::get().set_thread_name("wallpaper");
 		do {
 			_ctime_wp = std::chrono::system_clock::now();
 			const auto elapsed{_ctime_wp - _last_wp};
@@ -163,6 +165,7 @@ auto Sorcery::Animation::_animate_attract(bool force) -> void {
 	if (force)
 		_do_attract();
 	else {
+		Trace::get().set_thread_name("attract");
 		do {
 			_ctime_attract = std::chrono::system_clock::now();
 			const auto elapsed{_ctime_attract - _last_attract};
@@ -185,6 +188,7 @@ auto Sorcery::Animation::_colcyc(bool force) -> void {
 	if (force)
 		_do_colcyc();
 	else {
+		Trace::get().set_thread_name("colour cycling");
 		do {
 			if (_allow_colcyc)
 				_do_colcyc();
@@ -196,6 +200,8 @@ auto Sorcery::Animation::_colcyc(bool force) -> void {
 
 auto Sorcery::Animation::_do_wp() -> void {
 
+	TRACE_SCOPE("Animation::_do_wp");
+
 	std::scoped_lock<std::mutex> scoped_lock(_wp_mutex);
 
 	wp_idx = (*_random)[Enums::System::Random::D165];
@@ -204,6 +210,8 @@ auto Sorcery::Animation::_do_wp() -> void {
 
 auto Sorcery::Animation::_do_attract() -> void {
 
+	TRACE_SCOPE("Animation::_do_attract");
+
 	std::scoped_lock<std::mutex> scoped_lock(_attract_mutex);
 	auto index{0u};
 	const auto num{(*_random)[Enums::System::Random::D4]};
@@ -228,6 +236,8 @@ auto Sorcery::Animation::get_attract_data() -> std::vector<unsigned int> {
 // Called 50 times a second
 auto Sorcery::Animation::_do_colcyc() -> void {
 
+	TRACE_SCOPE("Animation::_do_colcyc");
+
 	std::scoped_lock<std::mutex> scoped_lock(_colcyc_mutex);
 
 	// Colour Lerp goes back and forth between 0 and 1
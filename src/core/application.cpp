@@ -21,10 +21,14 @@
 // the resulting work.
 
 #include "core/application.hpp"
+#include "core/allocations.hpp"
 #include "core/controller.hpp"
+#include "core/database.hpp"
 #include "core/display.hpp"
+#include "core/replay.hpp"
 #include "core/resources.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 #include "core/ui.hpp"
 #include "engine/define.hpp"
 #include "engine/engine.hpp"
@@ -33,11 +37,36 @@
 #include "gui/define.hpp"
 #include "modules/castle.hpp"
 #include "modules/edgeoftown.hpp"
+#include "resources/define.hpp"
+#include "resources/levelstore.hpp"
 #include "types/game.hpp"
 #include "types/state.hpp"
 
+namespace {
+
+// What --headless runs when not given a --script
+constexpr std::array<std::string_view, 10> default_script{
+	"new",	   "save",			"load",	   "render castle",
+	"maze -1", "render engine", "maze -2", "render engine",
+	"roster 200", "screens"};
+
+// Screens that are only drawn when given a mode, and the one to draw them in
+// (heal shows its first stage, levelup and nolevelup include a birthday)
+constexpr std::array<std::pair<std::string_view, int>, 8> screen_modes{
+	{{"roster", ROSTER_MODE_TAVERN},
+	 {"inspect", INSPECT_MODE_TAVERN},
+	 {"heal", 4},
+	 {"choose", CHOOSE_MODE_STAY},
+	 {"reorder", REORDER_MODE_TAVERN},
+	 {"recovery", RECOVERY_MODE_FREE},
+	 {"levelup", RECOVERY_BIRTHDAY},
+	 {"nolevelup", RECOVERY_BIRTHDAY}}};
+
+} // namespace
+
 // Standard Constructor
-Sorcery::Application::Application(int argc, char **argv) {
+Sorcery::Application::Application(int argc, char **argv)
+	: _in_maze{false} {
 
 	// Setup a Global Exception Handler as early as possible
 	std::set_terminate([]() -> void {
@@ -60,6 +89,44 @@ Sorcery::Application::Application(int argc, char **argv) {
 	_args.clear();
 	for (auto loop = 0; loop < argc; ++loop) {
 		std::string arg{argv[loop]};
+
+		// Start tracing straight away so that startup is included (and keep
+		// the case of the filename as given)
+		if (arg.starts_with(TRACE_PARAM) && arg.size() > TRACE_PARAM.size()) {
+			Trace::get().start(arg.substr(TRACE_PARAM.size()));
+			Trace::get().set_thread_name("main");
+		}
+
+		// Fail any frame that allocates too much (for automated runs); as
+		// these check nothing unless tracking is built in, refuse to carry on
+		// rather than quietly passing
+		if (arg.starts_with(ALLOCATION_BUDGET_PARAM)) {
+			if (!Allocations::is_tracking()) {
+				std::cerr << std::format("Allocation budget '{}' needs a build "
+										 "with SORCERY_TRACK_ALLOCATIONS=ON!",
+										 arg)
+						  << std::endl;
+				exit(EXIT_FAILURE);
+			}
+			const auto budget{
+				std::string_view{arg}.substr(ALLOCATION_BUDGET_PARAM.size())};
+			if (!Allocations::set_budget(budget)) {
+				std::cerr << std::format("Invalid allocation budget '{}'!", arg)
+						  << std::endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+
+		// Input recording and playback
+		if (arg.starts_with(RECORD_PARAM) && arg.size() > RECORD_PARAM.size())
+			_record = arg.substr(RECORD_PARAM.size());
+		if (arg.starts_with(REPLAY_PARAM) && arg.size() > REPLAY_PARAM.size())
+			_replay = arg.substr(REPLAY_PARAM.size());
+
+		// Script for headless mode (again keeping the case of the filename)
+		if (arg.starts_with(SCRIPT_PARAM) && arg.size() > SCRIPT_PARAM.size())
+			_script = arg.substr(SCRIPT_PARAM.size());
+
 		std::ranges::transform(arg.begin(), arg.end(), arg.begin(),
 							   [](unsigned char c) -> unsigned char {
 								   return std::tolower(c);
@@ -68,8 +135,11 @@ Sorcery::Application::Application(int argc, char **argv) {
 	}
 
 	// Set up all the Core Modules
+	TRACE_SCOPE("Application::setup");
 	_system = std::make_unique<System>(argc, argv);
-	_display = std::make_unique<Display>(_system.get());
+	_setup_replay();
+	_display =
+		std::make_unique<Display>(_system.get(), _check_param(HEADLESS_PARAM));
 	_resources = std::make_unique<Resources>(_system.get());
 	_controller = std::make_unique<Controller>(_system.get(), _display.get(),
 											   _resources.get());
@@ -100,6 +170,9 @@ Sorcery::Application::~Application() {}
 // Start the Game
 auto Sorcery::Application::start() -> int {
 
+	if (_display->is_headless())
+		return _do_headless();
+
 	_ui->start();
 
 	// Display Splash Screen (this will start loading resources)
@@ -266,10 +339,244 @@ auto Sorcery::Application::_do_town() -> int {
 	}
 }
 
+// A replay reuses the seed it was recorded with, so that (given the same input)
+// every roll comes out the same
+auto Sorcery::Application::_setup_replay() -> void {
+
+	if (!_replay.empty()) {
+		if (const auto seed{
+				Replay::get().replay(_replay, _check_param(REPLAY_TIMED_PARAM))};
+			seed)
+			_system->random->seed(seed.value());
+		else
+			std::cerr << std::format("Unable to replay '{}'!", _replay.string())
+					  << std::endl;
+	} else if (!_record.empty()) {
+		const auto seed{_system->random->get_seed()};
+		_system->random->seed(seed);
+		if (!Replay::get().record(_record, seed))
+			std::cerr << std::format("Unable to record to '{}'!",
+									 _record.string())
+					  << std::endl;
+	}
+}
+
+// Run a script of commands with no visible window (for automated performance
+// runs), printing how long each took; returns non-zero if any failed
+auto Sorcery::Application::_do_headless() -> int {
+
+	std::vector<std::string> commands{};
+	if (_script.empty())
+		commands.assign(default_script.begin(), default_script.end());
+	else {
+		std::ifstream file{_script};
+		if (!file.good()) {
+			std::cerr << std::format("Unable to read script '{}'!",
+									 _script.string())
+					  << std::endl;
+			SDL_Quit();
+			return EXIT_FAILURE;
+		}
+		for (std::string line; std::getline(file, line);)
+			if (!line.empty() && !line.starts_with('#'))
+				commands.push_back(line);
+	}
+
+	if (_display->has_GL())
+		_ui->start();
+	else
+		std::cerr << "No offscreen GL context, so nothing can be rendered!"
+				  << std::endl;
+
+	auto result{EXIT_SUCCESS};
+	std::println("{:<32}{:>12}{:>12}", "command", "total ms", "frame ms");
+	for (const auto &command : commands) {
+
+		const auto start{std::chrono::steady_clock::now()};
+		const auto frames{_run_headless_command(command)};
+		const auto ms{std::chrono::duration<double, std::milli>(
+						  std::chrono::steady_clock::now() - start)
+						  .count()};
+		if (!frames) {
+			std::cerr << std::format("Unable to run '{}'!", command)
+					  << std::endl;
+			result = EXIT_FAILURE;
+			break;
+		}
+
+		if (frames.value() > 0)
+			std::println("{:<32}{:>12.3f}{:>12.3f}", command, ms,
+						 ms / frames.value());
+		else
+			std::println("{:<32}{:>12.3f}{:>12}", command, ms, "-");
+	}
+
+	if (_display->has_GL())
+		_ui->stop();
+	else
+		SDL_Quit();
+
+	return result;
+}
+
+// One line of a headless script, which is one of:
+//   new                      start a new game with a quickstart party
+//   save                     save the game
+//   load                     load the saved game
+//   maze <depth> [<x> <y>]   go to a location in the maze (depth is negative)
+//   roster <n>               add n random characters to the tavern
+//   render <screen> [<n>]    draw a screen (or "engine") for n frames
+//   screens [<n>]            draw every screen for n frames, printing the
+//                            time per frame and ImGui vertices, indices and
+//                            draw calls of each
+// Returns the number of frames drawn, or nothing if the command failed
+auto Sorcery::Application::_run_headless_command(const std::string &command)
+	-> std::optional<int> {
+
+	TRACE_SCOPE("Application::headless");
+
+	std::istringstream stream{command};
+	std::string verb{};
+	stream >> verb;
+	if (verb == "new") {
+
+		_start_new_game(true);
+		return 0;
+	} else if (verb == "save") {
+
+		_game->save_game();
+		return 0;
+	} else if (verb == "load") {
+
+		if (!_system->db->has_game())
+			return std::nullopt;
+
+		_load_existing_game();
+		return 0;
+	} else if (verb == "maze") {
+
+		// Failed extractions leave zero, so x and y are optional
+		auto depth{0}, x{0}, y{0};
+		stream >> depth >> x >> y;
+		auto level{_game->levels->get(depth)};
+		if (!level)
+			return std::nullopt;
+
+		// As Engine does when changing level
+		_game->enter_maze();
+		_game->state->set_current_level(&level.value());
+		if (_display->has_GL())
+			_ui->prepare_view(level.value());
+		_game->state->set_player_pos(Coordinate{x, y});
+		_game->state->set_player_prev_depth(_game->state->get_depth());
+		_game->state->set_depth(depth);
+		_game->state->set_player_facing(Enums::Map::Direction::NORTH);
+		_in_maze = true;
+		return 0;
+	} else if (verb == "roster") {
+
+		auto count{0};
+		if (!(stream >> count) || count < 1)
+			return std::nullopt;
+
+		_add_random_roster(count);
+		return 0;
+	} else if (verb == "render") {
+
+		std::string screen{};
+		auto frames{HEADLESS_RENDER_FRAMES};
+		stream >> screen;
+		if (!(stream >> frames))
+			frames = HEADLESS_RENDER_FRAMES;
+		if (!_display->has_GL() || frames < 1 ||
+			!_render_screen(screen, frames))
+			return std::nullopt;
+
+		return frames;
+	} else if (verb == "screens") {
+
+		auto frames{HEADLESS_RENDER_FRAMES};
+		if (!(stream >> frames))
+			frames = HEADLESS_RENDER_FRAMES;
+		if (!_display->has_GL() || frames < 1)
+			return std::nullopt;
+
+		auto screens{_ui->get_screens()};
+		if (_in_maze)
+			screens.emplace_back("engine");
+		std::println("  {:<30}{:>12}{:>12}{:>12}{:>12}", "screen", "frame ms",
+					 "vertices", "indices", "draw calls");
+		for (const auto &screen : screens) {
+
+			const auto start{std::chrono::steady_clock::now()};
+			if (!_render_screen(screen, frames))
+				return std::nullopt;
+			const auto ms{std::chrono::duration<double, std::milli>(
+							  std::chrono::steady_clock::now() - start)
+							  .count()};
+			const auto stats{_ui->get_draw_stats()};
+			std::println("  {:<30}{:>12.3f}{:>12}{:>12}{:>12}", screen,
+						 ms / frames, stats.vertices, stats.indices,
+						 stats.draw_calls);
+		}
+
+		return frames * static_cast<int>(screens.size());
+	}
+
+	return std::nullopt;
+}
+
+// Draw a screen as if we were on it. The engine needs to be in the maze first,
+// any screens about one character use the first in the party, and the license
+// is drawn with the text from the license file
+auto Sorcery::Application::_render_screen(const std::string &screen,
+										  const int frames) -> bool {
+
+	if (!_ui->has_screen(screen) || (screen == "engine" && !_in_maze))
+		return false;
+
+	_controller->initialise(screen);
+	if (const auto party{_game->state->get_party_characters()};
+		!party.empty())
+		for (const auto flag : {"help", "inspect", "restart", "stay"})
+			_controller->set_character(flag, party.front());
+
+	const auto mode{std::ranges::find(
+		screen_modes, screen, [](const auto &pair) { return pair.first; })};
+	std::string license_text{};
+	if (screen == "license") {
+		if (std::ifstream file{(*_system->files)[LICENSE_FILE]}; file.good())
+			license_text.assign(std::istreambuf_iterator<char>(file),
+								std::istreambuf_iterator<char>());
+	}
+
+	for (auto frame = 0; frame < frames; frame++) {
+
+		// Nothing is listening, but the queue still needs emptying
+		SDL_Event event;
+		while (SDL_PollEvent(&event)) {
+		}
+
+		if (screen == "engine")
+			_ui->display_engine(_game.get());
+		else if (mode != screen_modes.end())
+			_ui->display(screen, _game.get(), mode->second);
+		else if (screen == "license")
+			_ui->display(screen, license_text);
+		else if (_ui->is_module(screen))
+			_ui->display(screen, _game.get());
+		else
+			_ui->display(screen);
+	}
+
+	return true;
+}
+
 auto Sorcery::Application::_load_existing_game() -> void {
 
 	_controller->busy = true;
-	_ui->display_refresh();
+	if (!_display->is_headless())
+		_ui->display_refresh();
 	_game->load_game();
 	_controller->busy = false;
 	_controller->set_game(_game.get());
@@ -278,7 +585,8 @@ auto Sorcery::Application::_load_existing_game() -> void {
 auto Sorcery::Application::_start_new_game(const bool quickstart) -> void {
 
 	_controller->busy = true;
-	_ui->display_refresh();
+	if (!_display->is_headless())
+		_ui->display_refresh();
 	_game->wipe_data();
 	_game->create_game();
 	_game->save_game();
@@ -378,14 +686,35 @@ auto Sorcery::Application::_add_quickstart_party() -> void {
 	_game->save_game();
 }
 
+// Fill the tavern with random characters (for testing with a large roster)
+auto Sorcery::Application::_add_random_roster(const int count) -> void {
+
+	for (auto i = 0; i < count; i++) {
+		auto pc{Character(_system.get(), _resources.get())};
+		pc.create_random();
+		pc.finalise();
+		pc.set_stage(Enums::Character::Stage::COMPLETED);
+		pc.set_location(Enums::Character::Location::TAVERN);
+		auto char_id{_game->save_character(pc)};
+		_game->characters[char_id] = pc;
+	}
+
+	_game->save_game();
+}
+
 auto Sorcery::Application::_continue_existing_game() -> int {}
 
 // Stop the Game
 auto Sorcery::Application::stop() -> void {
 
-	// Stop relevant animation worker threads
+	// Stop all the animation worker threads (the attract one may still be
+	// running if we quit from the main menu)
+	_system->animation->stop_attract_th();
 	_system->animation->stop_colcyc_th();
 	_system->animation->stop_wp_th();
+
+	// And write out any trace now nothing else is recording
+	Trace::get().stop();
 };
 
 // Check for a command line parameter
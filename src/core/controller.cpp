@@ -42,12 +42,13 @@ Sorcery::Controller::Controller(System *system, Display *display,
 
 	initialise("");
 	_game = nullptr;
+	show_profiler = false;
 }
 
 auto Sorcery::Controller::initialise(std::string_view value) -> void {
 
 	screen = value;
-	_flags.clear();
+	_flags.fill(false);
 	_texts.clear();
 	selected.clear();
 	_characters.clear();
@@ -101,8 +102,8 @@ auto Sorcery::Controller::initialise(std::string_view value) -> void {
 auto Sorcery::Controller::get_flags() const -> std::string {
 
 	std::string output{};
-	for (const auto &flag : _flags)
-		output.append(std::format("{:>26}: {}\n", flag.first, flag.second));
+	for (auto i = 0u; i < FLAG_COUNT; i++)
+		output.append(std::format("{:>26}: {}\n", FLAG_NAMES[i], _flags[i]));
 
 	return output;
 }
@@ -129,15 +130,19 @@ auto Sorcery::Controller::set_game(Game *game) -> void {
 
 auto Sorcery::Controller::check_for_debug(const SDL_Event event) -> void {
 
-	if (event.type == SDL_KEYDOWN &&
-		(event.key.keysym.sym >= SDLK_F1 && event.key.keysym.sym <= SDLK_F11)) {
+	if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F10)
+		show_profiler = !show_profiler;
+	else if (event.type == SDL_KEYDOWN &&
+			 (event.key.keysym.sym >= SDLK_F1 &&
+			  event.key.keysym.sym <= SDLK_F11)) {
 		if (_game != nullptr)
 			_game->call_debug(event.key.keysym.sym);
 	} else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12) {
 
 		std::println();
-		for (auto const &[key, val] : _flags)
-			std::println("{}", std::format("{:>32}: {}", key, val));
+		for (auto i = 0u; i < FLAG_COUNT; i++)
+			std::println("{}", std::format("{:>32}: {}", FLAG_NAMES[i],
+										   _flags[i]));
 	}
 }
 
@@ -449,7 +454,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 			break;
 		case MAIN_MENU_CONTINUE_GAME:
 			busy = true;
-			_flags["want_continue_game"] = true;
+			set_flag("want_continue_game");
 			break;
 		case MAIN_MENU_OPTIONS:
 			destination = selection;
@@ -483,7 +488,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 			move_screen("show_edge_of_town", "show_restart");
 			break;
 		case EDGE_OF_TOWN_GO_TO_MAZE:
-			_flags["want_enter_maze"] = true;
+			set_flag("want_enter_maze");
 			break;
 		case EDGE_OF_TOWN_LEAVE_GAME:
 			in_flags.at(0).get() = true;
@@ -549,7 +554,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 		else if (selection == CAMP_OPTIONS)
 			move_screen("show_engine", "show_options");
 		else if (selection == CAMP_QUIT)
-			_flags["want_quit_expedition"] = true;
+			set_flag("want_quit_expedition");
 		else if (selection == CAMP_LEAVE) {
 			// Exit from Camp
 		}
@@ -587,7 +592,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 			clear_character("tithe");
 		else {
 			set_character("tithe", data);
-			_flags["want_donate"] = true;
+			set_flag("want_donate");
 			in_flags.at(1).get() = true;
 		}
 
@@ -609,7 +614,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 
 		// Flags = &_ui->modal_identify->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_identify"] = true;
+			set_flag("want_identify");
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -617,7 +622,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 
 		// Flags = &_ui->modal_drop->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_drop"] = true;
+			set_flag("want_drop");
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -625,7 +630,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 
 		// Flags = &_ui->modal_trade->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_trade"] = true;
+			set_flag("want_trade");
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -633,7 +638,7 @@ auto Sorcery::Controller::handle_menu_with_flags(
 
 		// Flags = &_ui->modal_use->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_use"] = true;
+			set_flag("want_use");
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -641,42 +646,36 @@ auto Sorcery::Controller::handle_menu_with_flags(
 
 		// Flags = &_ui->modal_invoke->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_invoke"] = true;
+			set_flag("want_invoke");
 			in_flags.at(0).get() = false;
 		} else {
 		}
 	}
 }
 
-auto Sorcery::Controller::get_flag_ref(const std::string &flag) -> bool & {
+auto Sorcery::Controller::get_flag_ref(const Flag flag) -> bool & {
 
-	return _flags.at(flag);
+	return _flags[flag.id];
 }
 
-auto Sorcery::Controller::get_flag(const std::string &flag) const -> bool {
+auto Sorcery::Controller::get_flag(const Flag flag) const -> bool {
 
-	if (_flags.contains(flag))
-		return _flags.at(flag);
-	else
-		return false;
+	return _flags[flag.id];
 }
 
-auto Sorcery::Controller::set_flag(const std::string &flag) -> void {
+auto Sorcery::Controller::set_flag(const Flag flag) -> void {
 
-	_flags[flag] = true;
+	_flags[flag.id] = true;
 }
 
-auto Sorcery::Controller::unset_flag(const std::string &flag) -> void {
+auto Sorcery::Controller::unset_flag(const Flag flag) -> void {
 
-	_flags[flag] = false;
+	_flags[flag.id] = false;
 }
 
-auto Sorcery::Controller::has_flag(const std::string &flag) const -> bool {
+auto Sorcery::Controller::has_flag(const Flag flag) const -> bool {
 
-	if (_flags.contains(flag))
-		return _flags.at(flag) == true;
-
-	return false;
+	return _flags[flag.id];
 }
 
 auto Sorcery::Controller::has_text(const std::string &flag) const -> bool {
@@ -755,6 +754,7 @@ auto Sorcery::Controller::check_for_resize(const SDL_Event event, UI *ui)
 		auto sz{_display->get_SDL_window_size()};
 		ui->adj_grid_w = sz.w / ui->columns;
 		ui->adj_grid_h = sz.h / ui->rows;
+		ui->text_cache.invalidate();
 	};
 }
 
@@ -776,7 +776,7 @@ auto Sorcery::Controller::check_for_abort(const SDL_Event event) -> bool {
 
 	// SDL_QUIT event
 	if (event.type == SDL_QUIT) {
-		_flags["want_abort"] = true;
+		set_flag("want_abort");
 		return true;
 	}
 
@@ -784,7 +784,7 @@ auto Sorcery::Controller::check_for_abort(const SDL_Event event) -> bool {
 	if (event.type == SDL_WINDOWEVENT &&
 		event.window.event == SDL_WINDOWEVENT_CLOSE &&
 		event.window.windowID == SDL_GetWindowID(_display->get_SDL_window())) {
-		_flags["want_abort"] = true;
+		set_flag("want_abort");
 		return true;
 	}
 
@@ -896,7 +896,7 @@ auto Sorcery::Controller::handle_menu(const std::string &component,
 			// Get the ID of the Character if we can, add the character to
 			// the party
 			set_character("restart", data);
-			_flags["want_restart_expedition"] = true;
+			set_flag("want_restart_expedition");
 		}
 
 	} else if (component == "add_menu") {
@@ -917,23 +917,23 @@ auto Sorcery::Controller::handle_menu(const std::string &component,
 		// Roster has multiple entry points so need to rely upon
 		// calling screen to enable itself
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["show_roster"] = false;
+			unset_flag("show_roster");
 			clear_character("inspect");
 		} else {
 			set_character("inspect", data);
-			_flags["show_roster"] = false;
+			unset_flag("show_roster");
 		}
 	} else if (component == "reorder_menu") {
 
 		// Reorder has multiple entry points so need to rely upon
 		// calling screen to enable itself
 		if (selection == (static_cast<int>(items.size()) - 1))
-			_flags["show_reorder"] = false;
+			unset_flag("show_reorder");
 
 	} else if (component == "pay_menu") {
 
 		if (selection == (static_cast<int>(items.size()) - 1))
-			_flags["show_pay"] = false;
+			unset_flag("show_pay");
 		else
 			selected["pay_selected"] = selection;
 
@@ -984,7 +984,7 @@ auto Sorcery::Controller::handle_menu(const std::string &component,
 
 		// Character Selection
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["show_choose"] = false;
+			unset_flag("show_choose");
 			clear_character("choose");
 		} else
 			set_character("choose", data);
@@ -1000,9 +1000,9 @@ auto Sorcery::Controller::handle_menu(const std::string &component,
 }
 
 // Move from one screen to another
-auto Sorcery::Controller::move_screen(const std::string &from_screen,
-									  const std::string &to_screen) -> void {
+auto Sorcery::Controller::move_screen(const Flag from_screen,
+									  const Flag to_screen) -> void {
 
-	_flags[to_screen] = true;
-	_flags[from_screen] = false;
+	_flags[to_screen.id] = true;
+	_flags[from_screen.id] = false;
 }
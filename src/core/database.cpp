@@ -25,6 +25,7 @@
 #include "common/include.hpp"
 #include "common/macro.hpp"
 #include "common/types.hpp"
+#include "core/trace.hpp"
 #include "types/error.hpp"
 
 // Standard Constructor
@@ -49,6 +50,8 @@ Sorcery::Database::Database(const std::filesystem::path &fp)
 // Reset and Clean the Database
 auto Sorcery::Database::wipe_data() -> void {
 
+	TRACE_SCOPE("Database::wipe_data");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -76,6 +79,8 @@ auto Sorcery::Database::wipe_data() -> void {
 
 auto Sorcery::Database::has_game() -> bool {
 
+	TRACE_SCOPE("Database::has_game");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -98,6 +103,8 @@ auto Sorcery::Database::has_game() -> bool {
 
 auto Sorcery::Database::load_game_state() -> std::optional<GameEntry> {
 
+	TRACE_SCOPE("Database::load_game_state");
+
 	try {
 
 		if (has_game()) {
@@ -152,6 +159,8 @@ auto Sorcery::Database::load_game_state() -> std::optional<GameEntry> {
 auto Sorcery::Database::save_game_state(int game_id, std::string key,
 										std::string data) -> void {
 
+	TRACE_SCOPE("Database::save_game_state");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -179,6 +188,8 @@ auto Sorcery::Database::save_game_state(int game_id, std::string key,
 
 auto Sorcery::Database::create_game_state(std::string data) -> unsigned int {
 
+	TRACE_SCOPE("Database::create_game_state");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -219,6 +230,8 @@ auto Sorcery::Database::update_character(int game_id, int char_id,
 										 std::string name, std::string data)
 	-> bool {
 
+	TRACE_SCOPE("Database::update_character");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -243,6 +256,8 @@ auto Sorcery::Database::update_character(int game_id, int char_id,
 auto Sorcery::Database::add_character(int game_id, std::string name,
 									  std::string data) -> unsigned int {
 
+	TRACE_SCOPE("Database::add_character");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -274,6 +289,8 @@ auto Sorcery::Database::add_character(int game_id, std::string name,
 auto Sorcery::Database::get_character_ids(int game_id)
 	-> std::vector<unsigned int> {
 
+	TRACE_SCOPE("Database::get_character_ids");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -300,6 +317,8 @@ auto Sorcery::Database::get_character_ids(int game_id)
 
 auto Sorcery::Database::delete_character(int game_id, int char_id) -> void {
 
+	TRACE_SCOPE("Database::delete_character");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -320,6 +339,8 @@ auto Sorcery::Database::delete_character(int game_id, int char_id) -> void {
 
 auto Sorcery::Database::get_character(int game_id, int char_id) -> std::string {
 
+	TRACE_SCOPE("Database::get_character");
+
 	try {
 
 		sqlite::database db(_fp.string());
@@ -23,18 +23,36 @@
 #include "core/display.hpp"
 #include "core/system.hpp"
 
-Sorcery::Display::Display(System *system)
-	: _system{system} {
+Sorcery::Display::Display(System *system, const bool headless)
+	: _system{system},
+	  _SDL_window{nullptr},
+	  _GL_context{nullptr},
+	  _headless{headless},
+	  _has_GL{false} {
 
 	initialise_SDL();
 };
 
 auto Sorcery::Display::initialise_SDL() -> int {
 
+	// When headless, render into a hidden window with an offscreen (EGL) GL
+	// context, and if even that isn't available, carry on without any GL
+	if (_headless)
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_GAMECONTROLLER) !=
 		0) {
 		std::println("Error: {}", SDL_GetError());
-		return -1;
+		if (!_headless)
+			return -1;
+
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+		if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
+			std::println("Error: {}", SDL_GetError());
+			return -1;
+		}
+
+		return 0;
 	}
 
 	// Using GL 3.0 + GLSL 130
@@ -45,6 +63,21 @@ auto Sorcery::Display::initialise_SDL() -> int {
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
 
+	if (!_create_window()) {
+		std::println("Error: {}", SDL_GetError());
+		if (_SDL_window != nullptr)
+			SDL_DestroyWindow(_SDL_window);
+		_SDL_window = nullptr;
+		_GL_context = nullptr;
+		return _headless ? 0 : -1;
+	}
+	_has_GL = true;
+
+	return 1;
+}
+
+auto Sorcery::Display::_create_window() -> bool {
+
 	// Create SDL Window with an Open GL Graphics Context
 	auto window_title{(*_system->strings)["WINDOW_TITLE"]};
 	auto window_w{std::stoi((*_system->config).get("Window", "width"))};
@@ -57,19 +90,38 @@ auto Sorcery::Display::initialise_SDL() -> int {
 	SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
 
 	_SDL_window_flags =
-		(SDL_WindowFlags)(SDL_WINDOW_OPENGL | SDL_WINDOW_ALLOW_HIGHDPI |
-						  SDL_WINDOW_RESIZABLE);
+		_headless ? (SDL_WindowFlags)(SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN)
+				  : (SDL_WindowFlags)(SDL_WINDOW_OPENGL |
+									  SDL_WINDOW_ALLOW_HIGHDPI |
+									  SDL_WINDOW_RESIZABLE);
 	_SDL_window = SDL_CreateWindow(window_title.c_str(), SDL_WINDOWPOS_CENTERED,
 								   SDL_WINDOWPOS_CENTERED, window_w, window_h,
 								   _SDL_window_flags);
+	if (_SDL_window == nullptr)
+		return false;
 
 	SDL_SetWindowMinimumSize(_SDL_window, min_window_w, min_window_h);
 	// SDL_MaximizeWindow(_SDL_window);
 	_GL_context = SDL_GL_CreateContext(_SDL_window);
+	if (_GL_context == nullptr)
+		return false;
+
 	SDL_GL_MakeCurrent(_SDL_window, _GL_context);
-	SDL_GL_SetSwapInterval(1); // Enable vsync
 
-	return 1;
+	// Anything past OpenGL 1.1 goes through GLEW, so load it now. If it fails
+	// (or there is no 3.0) anything that needs it falls back or is skipped
+	glewExperimental = GL_TRUE;
+	if (const auto glew{glewInit()}; glew != GLEW_OK)
+		std::println("Error: {}",
+					 reinterpret_cast<const char *>(glewGetErrorString(glew)));
+	else if (!GLEW_VERSION_3_0)
+		std::println("Warning: OpenGL 3.0 is not available");
+	glGetError();
+
+	// No vsync when headless, so that timings are of the work alone
+	SDL_GL_SetSwapInterval(_headless ? 0 : 1);
+
+	return true;
 }
 
 auto Sorcery::Display::get_SDL_window() -> SDL_Window * {
@@ -92,4 +144,15 @@ auto Sorcery::Display::get_GL_context() -> SDL_GLContext {
 auto Sorcery::Display::get_GLSL_version() const -> const char * {
 
 	return _GLSL_version.c_str();
-}
\ No newline at end of file
+}
+
+// True unless headless and no offscreen context could be made
+auto Sorcery::Display::has_GL() const -> bool {
+
+	return _has_GL;
+}
+
+auto Sorcery::Display::is_headless() const -> bool {
+
+	return _headless;
+}
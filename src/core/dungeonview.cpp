@@ -0,0 +1,526 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/dungeonview.hpp"
+#include "core/define.hpp"
+#include "core/system.hpp"
+#include "core/trace.hpp"
+#include "resources/filestore.hpp"
+
+// stb_image is implemented in the image store
+#include "stb/stb_image.h"
+
+namespace {
+
+constexpr std::string_view VERTEX_SHADER{R"(
+in vec3 a_position;
+in vec3 a_uv;
+in float a_shade;
+uniform mat4 u_view;
+uniform mat4 u_projection;
+out vec3 v_uv;
+out float v_shade;
+out float v_depth;
+void main() {
+	vec4 eye = u_view * vec4(a_position, 1.0);
+	gl_Position = u_projection * eye;
+	v_uv = a_uv;
+	v_shade = a_shade;
+	v_depth = -eye.z;
+}
+)"};
+
+// Light falls off with distance from the party, and fades with the rest of
+// the screen; monochrome mode draws the view in shades of grey
+constexpr std::string_view FRAGMENT_SHADER{R"(
+uniform sampler2DArray u_texture;
+uniform float u_fade;
+uniform int u_monochrome;
+uniform float u_distance;
+in vec3 v_uv;
+in float v_shade;
+in float v_depth;
+out vec4 o_colour;
+void main() {
+	float light = v_shade * u_fade * clamp(1.0 - v_depth / u_distance, 0.0, 1.0);
+	vec3 colour = texture(u_texture, v_uv).rgb * light;
+	if (u_monochrome != 0)
+		colour = vec3(dot(colour, vec3(0.299, 0.587, 0.114)));
+	o_colour = vec4(colour, 1.0);
+}
+)"};
+
+// Walls are pulled in very slightly from the tile edge so that the faces of
+// two neighbouring tiles sharing an edge don't fight over the same plane
+constexpr auto WALL_INSET{0.002f};
+
+// How far back from the middle of the square the party stands
+constexpr auto EYE_OFFSET{0.4f};
+
+using Matrix = std::array<float, 16>;
+
+// Column-major, as OpenGL expects
+auto perspective(const float fov, const float aspect, const float near,
+				 const float far) -> Matrix {
+
+	const auto f{1.0f / std::tan(fov * std::numbers::pi_v<float> / 360.0f)};
+	Matrix m{};
+	m[0] = f / aspect;
+	m[5] = f;
+	m[10] = (far + near) / (near - far);
+	m[11] = -1.0f;
+	m[14] = (2.0f * far * near) / (near - far);
+
+	return m;
+}
+
+// Looking horizontally along forward (a unit vector in the xz plane)
+auto look(const float x, const float y, const float z, const float forward_x,
+		  const float forward_z) -> Matrix {
+
+	// Side is forward x up, and up is unchanged as the view is always level
+	const auto side_x{-forward_z};
+	const auto side_z{forward_x};
+	Matrix m{};
+	m[0] = side_x;
+	m[8] = side_z;
+	m[5] = 1.0f;
+	m[2] = -forward_x;
+	m[10] = -forward_z;
+	m[12] = -(side_x * x + side_z * z);
+	m[13] = -y;
+	m[14] = forward_x * x + forward_z * z;
+	m[15] = 1.0f;
+
+	return m;
+}
+
+} // namespace
+
+// GL objects are created on first use, as there may not be a context yet
+Sorcery::DungeonView::DungeonView(System *system, const char *glsl_version)
+	: _system{system},
+	  _glsl_version{glsl_version},
+	  _available{std::nullopt},
+	  _program{0},
+	  _texture{0},
+	  _layers{0},
+	  _u_view{-1},
+	  _u_projection{-1},
+	  _u_fade{-1},
+	  _u_monochrome{-1},
+	  _u_distance{-1},
+	  _u_texture{-1},
+	  _view{},
+	  _projection{},
+	  _viewport{0, 0, 0, 0},
+	  _count{0},
+	  _vao{0},
+	  _fade{1.0f},
+	  _distance{DUNGEON_VIEW_DISTANCE},
+	  _monochrome{false} {}
+
+// Any level still being built is waited for by its future
+Sorcery::DungeonView::~DungeonView() {
+
+	for (auto &[depth, mesh] : _meshes) {
+		glDeleteBuffers(1, &mesh.vbo);
+		glDeleteVertexArrays(1, &mesh.vao);
+	}
+	if (_available.value_or(false)) {
+		glDeleteTextures(1, &_texture);
+		glDeleteProgram(_program);
+	}
+}
+
+// False if it is turned off, there is no OpenGL 3.0, or the shaders or the wall
+// textures could not be loaded, in which case the caller should draw the view
+// some other way
+auto Sorcery::DungeonView::is_available() -> bool {
+
+	if (!_available)
+		_available = _init();
+
+	return _available.value();
+}
+
+// Start building a level's geometry in the background, unless we have it
+auto Sorcery::DungeonView::prepare(const Level &level) -> void {
+
+	if (!is_available())
+		return;
+
+	const auto depth{level.depth()};
+	if (_meshes.contains(depth) || _pending.contains(depth))
+		return;
+
+	_pending.emplace(depth, std::async(std::launch::async,
+									   &DungeonView::_build, level, _layers));
+}
+
+// Uploads the level's geometry if it has finished building since last time
+auto Sorcery::DungeonView::is_ready(const int depth) -> bool {
+
+	if (auto it{_meshes.find(depth)}; it != _meshes.end())
+		return it->second.count > 0;
+
+	auto it{_pending.find(depth)};
+	if (it == _pending.end() || it->second.wait_for(std::chrono::seconds{0}) !=
+									std::future_status::ready)
+		return false;
+
+	std::vector<ViewVertex> vertices{};
+	try {
+		vertices = it->second.get();
+	} catch (std::exception &) {
+		vertices.clear();
+	}
+	_pending.erase(it);
+
+	const auto mesh{_upload(vertices)};
+	_meshes[depth] = mesh;
+
+	return mesh.count > 0;
+}
+
+auto Sorcery::DungeonView::submit(ImDrawList *draw_list, const int depth,
+								  const Coordinate loc,
+								  const Enums::Map::Direction facing,
+								  const ImVec2 pos, const ImVec2 size,
+								  const float fade, const bool monochrome,
+								  const bool lit) -> void {
+
+	using enum Enums::Map::Direction;
+
+	auto it{_meshes.find(depth)};
+	if (it == _meshes.end() || it->second.count == 0)
+		return;
+
+	// North is up the map, which is into the screen (-z)
+	const auto [forward_x, forward_z]{std::invoke([&] {
+		switch (facing) {
+		case EAST:
+			return std::pair{1.0f, 0.0f};
+		case SOUTH:
+			return std::pair{0.0f, 1.0f};
+		case WEST:
+			return std::pair{-1.0f, 0.0f};
+		default:
+			return std::pair{0.0f, -1.0f};
+		}
+	})};
+	const auto eye_x{loc.x + 0.5f - forward_x * EYE_OFFSET};
+	const auto eye_z{-(loc.y + 0.5f) - forward_z * EYE_OFFSET};
+	_view = look(eye_x, 0.5f, eye_z, forward_x, forward_z);
+	_projection = perspective(DUNGEON_VIEW_FOV, size.x / size.y, 0.05f,
+							  DUNGEON_VIEW_DISTANCE + 1.0f);
+
+	// The viewport is in framebuffer pixels, from the bottom left
+	const auto viewport{ImGui::GetMainViewport()};
+	const auto scale{ImGui::GetIO().DisplayFramebufferScale};
+	_viewport = {
+		static_cast<GLint>((pos.x - viewport->Pos.x) * scale.x),
+		static_cast<GLint>(
+			(viewport->Size.y - (pos.y - viewport->Pos.y + size.y)) * scale.y),
+		static_cast<GLint>(size.x * scale.x),
+		static_cast<GLint>(size.y * scale.y)};
+
+	_vao = it->second.vao;
+	_count = it->second.count;
+	_fade = fade;
+	_distance = lit ? DUNGEON_VIEW_DISTANCE : DUNGEON_VIEW_DISTANCE_DARK;
+	_monochrome = monochrome;
+
+	draw_list->AddCallback(&DungeonView::_callback, this);
+	draw_list->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+}
+
+// Runs on a worker thread, so only touches its own copy of the level
+auto Sorcery::DungeonView::_build(Level level, const unsigned int layers)
+	-> std::vector<ViewVertex> {
+
+	TRACE_SCOPE("DungeonView::_build");
+
+	using enum Enums::Map::Direction;
+	using enum Enums::Tile::Edge;
+
+	std::vector<ViewVertex> vertices{};
+	const auto bottom_left{level.bottom_left()};
+	const auto top_right{level.top_right()};
+	vertices.reserve((top_right.x - bottom_left.x + 1) *
+					 (top_right.y - bottom_left.y + 1) * 6 * 4);
+
+	// Corners are given anticlockwise from the bottom left of the face
+	const auto add_quad{[&](const std::array<std::array<float, 3>, 4> &corners,
+							const unsigned int layer, const float shade) {
+		constexpr std::array<std::array<float, 2>, 4> uvs{
+			{{0.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, 0.0f}}};
+		for (const auto i : {0, 1, 2, 0, 2, 3})
+			vertices.push_back(ViewVertex{
+				corners[i][0], corners[i][1], corners[i][2], uvs[i][0],
+				uvs[i][1], static_cast<float>(layer), shade});
+	}};
+
+	const auto first_wall{DUNGEON_DOOR_LAYER + 1};
+	for (auto y = bottom_left.y; y <= top_right.y; y++) {
+		for (auto x = bottom_left.x; x <= top_right.x; x++) {
+
+			auto &tile{level.at(x, y)};
+			const auto shade{tile.is(Enums::Tile::Properties::DARKNESS) ? 0.0f
+																	   : 1.0f};
+			const auto wall{first_wall +
+							tile.gfx().value_or(0) % (layers - first_wall)};
+
+			const auto x0{static_cast<float>(x)};
+			const auto x1{x0 + 1.0f};
+			const auto z0{-static_cast<float>(y)};
+			const auto z1{z0 - 1.0f};
+			add_quad({{{x0, 0, z0}, {x1, 0, z0}, {x1, 0, z1}, {x0, 0, z1}}},
+					 DUNGEON_FLOOR_LAYER, shade);
+			add_quad({{{x0, 1, z1}, {x1, 1, z1}, {x1, 1, z0}, {x0, 1, z0}}},
+					 DUNGEON_CEILING_LAYER, shade);
+
+			// Secret and hidden doors are always drawn as walls, as nothing
+			// reveals them yet (and a level's mesh is kept once built)
+			for (const auto direction : {NORTH, EAST, SOUTH, WEST}) {
+				const auto is_door{tile.has(direction, UNLOCKED_DOOR) ||
+								   tile.has(direction, LOCKED_DOOR) ||
+								   tile.has(direction, ONE_WAY_DOOR)};
+				const auto is_wall{tile.has(direction, WALL) ||
+								   tile.has(direction, ONE_WAY_WALL) ||
+								   tile.has(direction, HIDDEN_DOOR) ||
+								   tile.has(direction, SECRET_DOOR) ||
+								   tile.has(direction, ONE_WAY_HIDDEN_DOOR)};
+				if (!is_door && !is_wall)
+					continue;
+
+				const auto layer{is_door ? DUNGEON_DOOR_LAYER : wall};
+				const auto n{z1 + WALL_INSET};
+				const auto s{z0 - WALL_INSET};
+				const auto e{x1 - WALL_INSET};
+				const auto w{x0 + WALL_INSET};
+				switch (direction) {
+				case NORTH:
+					add_quad({{{x0, 0, n}, {x1, 0, n}, {x1, 1, n}, {x0, 1, n}}},
+							 layer, shade);
+					break;
+				case EAST:
+					add_quad({{{e, 0, z0}, {e, 0, z1}, {e, 1, z1}, {e, 1, z0}}},
+							 layer, shade);
+					break;
+				case SOUTH:
+					add_quad({{{x1, 0, s}, {x0, 0, s}, {x0, 1, s}, {x1, 1, s}}},
+							 layer, shade);
+					break;
+				case WEST:
+					add_quad({{{w, 0, z1}, {w, 0, z0}, {w, 1, z0}, {w, 1, z1}}},
+							 layer, shade);
+					break;
+				default:
+					break;
+				}
+			}
+		}
+	}
+
+	return vertices;
+}
+
+auto Sorcery::DungeonView::_callback(
+	[[maybe_unused]] const ImDrawList *draw_list, const ImDrawCmd *cmd)
+	-> void {
+
+	static_cast<DungeonView *>(cmd->UserCallbackData)->_render();
+}
+
+auto Sorcery::DungeonView::_init() -> bool {
+
+	// Array textures, shaders and vertex arrays all need OpenGL 3.0
+	if (_system->config->get("Graphics", TEXTURED_VIEW_KEY) != OPT_ON ||
+		!GLEW_VERSION_3_0)
+		return false;
+
+	const auto vertex_shader{_compile(GL_VERTEX_SHADER, VERTEX_SHADER)};
+	const auto fragment_shader{_compile(GL_FRAGMENT_SHADER, FRAGMENT_SHADER)};
+	if (vertex_shader == 0 || fragment_shader == 0) {
+		glDeleteShader(vertex_shader);
+		glDeleteShader(fragment_shader);
+		return false;
+	}
+
+	_program = glCreateProgram();
+	glAttachShader(_program, vertex_shader);
+	glAttachShader(_program, fragment_shader);
+	glBindAttribLocation(_program, 0, "a_position");
+	glBindAttribLocation(_program, 1, "a_uv");
+	glBindAttribLocation(_program, 2, "a_shade");
+	glLinkProgram(_program);
+	glDeleteShader(vertex_shader);
+	glDeleteShader(fragment_shader);
+
+	GLint linked{GL_FALSE};
+	glGetProgramiv(_program, GL_LINK_STATUS, &linked);
+	if (linked != GL_TRUE || !_load_textures()) {
+		glDeleteProgram(_program);
+		_program = 0;
+		return false;
+	}
+
+	_u_view = glGetUniformLocation(_program, "u_view");
+	_u_projection = glGetUniformLocation(_program, "u_projection");
+	_u_fade = glGetUniformLocation(_program, "u_fade");
+	_u_monochrome = glGetUniformLocation(_program, "u_monochrome");
+	_u_distance = glGetUniformLocation(_program, "u_distance");
+	_u_texture = glGetUniformLocation(_program, "u_texture");
+
+	return true;
+}
+
+// Cut the texture sheet into square layers of an array texture, left to right
+// and then top to bottom, with mipmaps so distant walls don't shimmer
+auto Sorcery::DungeonView::_load_textures() -> bool {
+
+	auto width{0};
+	auto height{0};
+	auto channels{0};
+	unsigned char *pixels{
+		stbi_load((*_system->files)[DUNGEON_TEXTURE].string().c_str(), &width,
+				  &height, &channels, 4)};
+	if (pixels == nullptr)
+		return false;
+
+	const auto columns{width / DUNGEON_TEXTURE_SIZE};
+	const auto rows{height / DUNGEON_TEXTURE_SIZE};
+	_layers = static_cast<unsigned int>(columns * rows);
+	if (_layers <= DUNGEON_DOOR_LAYER + 1) {
+		stbi_image_free(pixels);
+		return false;
+	}
+
+	glGenTextures(1, &_texture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, _texture);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, DUNGEON_TEXTURE_SIZE,
+				 DUNGEON_TEXTURE_SIZE, static_cast<GLsizei>(_layers), 0,
+				 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+	for (auto layer = 0; layer < columns * rows; layer++) {
+		const auto x{(layer % columns) * DUNGEON_TEXTURE_SIZE};
+		const auto y{(layer / columns) * DUNGEON_TEXTURE_SIZE};
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+						DUNGEON_TEXTURE_SIZE, DUNGEON_TEXTURE_SIZE, 1, GL_RGBA,
+						GL_UNSIGNED_BYTE,
+						pixels + (static_cast<std::size_t>(y) * width + x) * 4);
+	}
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+					GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	stbi_image_free(pixels);
+
+	return true;
+}
+
+auto Sorcery::DungeonView::_compile(const GLenum type, std::string_view source)
+	-> GLuint {
+
+	const auto shader{glCreateShader(type)};
+	const std::array<const GLchar *, 2> sources{_glsl_version.c_str(),
+												source.data()};
+	const std::array<GLint, 2> lengths{
+		static_cast<GLint>(_glsl_version.size()),
+		static_cast<GLint>(source.size())};
+	glShaderSource(shader, 2, sources.data(), lengths.data());
+	glCompileShader(shader);
+
+	GLint compiled{GL_FALSE};
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+	if (compiled != GL_TRUE) {
+		glDeleteShader(shader);
+		return 0;
+	}
+
+	return shader;
+}
+
+auto Sorcery::DungeonView::_upload(const std::vector<ViewVertex> &vertices)
+	-> LevelMesh {
+
+	LevelMesh mesh{0, 0, static_cast<GLsizei>(vertices.size())};
+	if (vertices.empty())
+		return mesh;
+
+	glGenVertexArrays(1, &mesh.vao);
+	glGenBuffers(1, &mesh.vbo);
+	glBindVertexArray(mesh.vao);
+	glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(ViewVertex),
+				 vertices.data(), GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(ViewVertex),
+						  reinterpret_cast<void *>(offsetof(ViewVertex, x)));
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(ViewVertex),
+						  reinterpret_cast<void *>(offsetof(ViewVertex, u)));
+	glVertexAttribPointer(
+		2, 1, GL_FLOAT, GL_FALSE, sizeof(ViewVertex),
+		reinterpret_cast<void *>(offsetof(ViewVertex, shade)));
+	glBindVertexArray(0);
+
+	return mesh;
+}
+
+// Called from within ImGui's renderer, which restores its own state afterwards
+// (except for depth testing, which it only ever disables)
+auto Sorcery::DungeonView::_render() -> void {
+
+	glViewport(_viewport[0], _viewport[1], _viewport[2], _viewport[3]);
+	glEnable(GL_SCISSOR_TEST);
+	glScissor(_viewport[0], _viewport[1], _viewport[2], _viewport[3]);
+	glDepthMask(GL_TRUE);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glDisable(GL_BLEND);
+	glDisable(GL_CULL_FACE);
+
+	glUseProgram(_program);
+	glUniformMatrix4fv(_u_view, 1, GL_FALSE, _view.data());
+	glUniformMatrix4fv(_u_projection, 1, GL_FALSE, _projection.data());
+	glUniform1f(_u_fade, _fade);
+	glUniform1i(_u_monochrome, _monochrome ? 1 : 0);
+	glUniform1f(_u_distance, _distance);
+	glUniform1i(_u_texture, 0);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, _texture);
+	glBindVertexArray(_vao);
+
+	glDrawArrays(GL_TRIANGLES, 0, _count);
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	glDisable(GL_DEPTH_TEST);
+}
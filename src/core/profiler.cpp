@@ -0,0 +1,177 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/profiler.hpp"
+
+namespace {
+
+// Nesting depth of the scopes currently open on this thread
+thread_local std::uint32_t scope_depth{0};
+
+} // namespace
+
+Sorcery::Profiler::Profiler()
+	: _samples{},
+	  _frames{},
+	  _head{0},
+	  _frame_count{0},
+	  _frame_start{now()},
+	  _frame_first{0},
+	  _frame_allocations{Allocations::get_total()} {}
+
+// There is only ever the one, as scopes can be anywhere in the code
+auto Sorcery::Profiler::get() -> Profiler & {
+
+	static Profiler profiler{};
+
+	return profiler;
+}
+
+auto Sorcery::Profiler::now() -> std::int64_t {
+
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			   std::chrono::steady_clock::now().time_since_epoch())
+		.count();
+}
+
+// Close off the current frame and start the next (main thread only)
+auto Sorcery::Profiler::next_frame() -> void {
+
+	const auto time{now()};
+	const auto head{_head.load(std::memory_order_acquire)};
+	const auto allocations{Allocations::get_total()};
+	_frames[_frame_count % PROFILE_FRAME_COUNT] = ProfileFrame{
+		_frame_start, time, _frame_first, head,
+		AllocationCount{allocations.count - _frame_allocations.count,
+						allocations.bytes - _frame_allocations.bytes}};
+	++_frame_count;
+	_frame_start = time;
+	_frame_first = head;
+	_frame_allocations = allocations;
+}
+
+auto Sorcery::Profiler::record(const char *name, const std::int64_t start,
+							   const std::int64_t end,
+							   const std::uint32_t depth,
+							   const AllocationCount allocations) -> void {
+
+	const auto sample{_head.fetch_add(1, std::memory_order_acq_rel)};
+	auto &slot{_samples[sample % PROFILE_SAMPLE_COUNT]};
+	slot.sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.name.store(name, std::memory_order_relaxed);
+	slot.start.store(start, std::memory_order_relaxed);
+	slot.end.store(end, std::memory_order_relaxed);
+	slot.depth.store(depth, std::memory_order_relaxed);
+	slot.count.store(allocations.count, std::memory_order_relaxed);
+	slot.bytes.store(allocations.bytes, std::memory_order_relaxed);
+	slot.sequence.store(sample + 1, std::memory_order_release);
+}
+
+// Returns the time range of the frame, and only those of its samples that have
+// been written and not yet overwritten (checked before and after reading)
+auto Sorcery::Profiler::get_last_frame(std::vector<ProfileSample> &samples)
+	const -> std::pair<std::int64_t, std::int64_t> {
+
+	samples.clear();
+	if (_frame_count == 0)
+		return {0, 0};
+
+	const auto &frame{_frames[(_frame_count - 1) % PROFILE_FRAME_COUNT]};
+	const auto head{_head.load(std::memory_order_acquire)};
+	const auto oldest{head > PROFILE_SAMPLE_COUNT ? head - PROFILE_SAMPLE_COUNT
+												  : 0};
+	for (auto i = std::max(frame.first, oldest); i < frame.last; i++) {
+		const auto &slot{_samples[i % PROFILE_SAMPLE_COUNT]};
+		if (slot.sequence.load(std::memory_order_acquire) != i + 1)
+			continue;
+
+		const ProfileSample sample{
+			slot.name.load(std::memory_order_relaxed),
+			slot.start.load(std::memory_order_relaxed),
+			slot.end.load(std::memory_order_relaxed),
+			slot.depth.load(std::memory_order_relaxed),
+			AllocationCount{slot.count.load(std::memory_order_relaxed),
+							slot.bytes.load(std::memory_order_relaxed)}};
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot.sequence.load(std::memory_order_relaxed) == i + 1)
+			samples.push_back(sample);
+	}
+
+	return {frame.start, frame.end};
+}
+
+auto Sorcery::Profiler::get_last_allocations() const -> AllocationCount {
+
+	if (_frame_count == 0)
+		return AllocationCount{0, 0};
+
+	return _frames[(_frame_count - 1) % PROFILE_FRAME_COUNT].allocations;
+}
+
+// Durations of the frames we have, oldest first, in milliseconds
+auto Sorcery::Profiler::get_frame_times() const -> std::vector<float> {
+
+	const auto count{
+		std::min<std::uint64_t>(_frame_count, PROFILE_FRAME_COUNT)};
+	std::vector<float> times{};
+	times.reserve(count);
+	for (auto i = _frame_count - count; i < _frame_count; i++) {
+		const auto &frame{_frames[i % PROFILE_FRAME_COUNT]};
+		times.push_back(static_cast<float>(frame.end - frame.start) / 1e6f);
+	}
+
+	return times;
+}
+
+// 50th, 95th and 99th percentile frame times in milliseconds
+auto Sorcery::Profiler::get_percentiles() const -> std::array<float, 3> {
+
+	auto times{get_frame_times()};
+	if (times.empty())
+		return {0.0f, 0.0f, 0.0f};
+
+	std::ranges::sort(times);
+	const auto at{[&](const float percentile) {
+		return times[static_cast<std::size_t>(percentile *
+											  (times.size() - 1))];
+	}};
+
+	return {at(0.50f), at(0.95f), at(0.99f)};
+}
+
+// Allocations are counted on this thread only, including any nested scopes
+Sorcery::ProfileScope::ProfileScope(const char *name)
+	: _name{name},
+	  _start{Profiler::now()},
+	  _depth{scope_depth++},
+	  _allocations{Allocations::get_thread()} {}
+
+Sorcery::ProfileScope::~ProfileScope() {
+
+	--scope_depth;
+	const auto allocations{Allocations::get_thread()};
+	Profiler::get().record(
+		_name, _start, Profiler::now(), _depth,
+		AllocationCount{allocations.count - _allocations.count,
+						allocations.bytes - _allocations.bytes});
+}
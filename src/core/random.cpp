@@ -21,11 +21,15 @@
 // the resulting work.
 
 #include "core/random.hpp"
+#include "types/dice.hpp"
+#include "types/itemtype.hpp"
+#include "types/monstertype.hpp"
 
 Sorcery::Random::Random() {
 
 	// Random Seeding Device
-	_random = std::mt19937_64(_device());
+	_seed = (static_cast<std::uint64_t>(_device()) << 32) | _device();
+	_random = std::mt19937_64(_seed);
 
 	// Populate Ranges
 	using enum Enums::System::Random;
@@ -132,4 +136,26 @@ auto Sorcery::Random::get(const unsigned int min, const unsigned int max)
 	// Generate a random number of a specified range
 	auto dist{std::uniform_int_distribution<unsigned int>(min, max)};
 	return dist(_random);
-}
\ No newline at end of file
+}
+
+// A raw 64 bit random number, for callers that do their own scaling
+auto Sorcery::Random::get_bits() -> std::uint64_t {
+
+	return _random();
+}
+
+auto Sorcery::Random::get_seed() const -> std::uint64_t {
+
+	return _seed;
+}
+
+// Seed this and the other shared RNGs (each its own stream) so that a run can
+// be repeated exactly
+auto Sorcery::Random::seed(const std::uint64_t value) -> void {
+
+	_seed = value;
+	_random.seed(value);
+	Dice::seed(value + 1);
+	ItemType::seed(value + 2);
+	MonsterType::seed(value + 3);
+}
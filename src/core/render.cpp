@@ -23,6 +23,7 @@
 #include "core/render.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "types/game.hpp"
@@ -34,8 +35,11 @@ Sorcery::Render::Render(System *system, Display *display, UI *ui,
 	: _system{system},
 	  _display{display},
 	  _ui{ui},
-	  _controller{controller} {
+	  _controller{controller},
+	  _wireframe{display->get_GLSL_version()},
+	  _dungeon_view{system, display->get_GLSL_version()} {
 
+	_use_wireframe = false;
 	_monochrome = false;
 	_source_size = ImVec2{912.0f * 4, 880.0f * 4};
 	_pane_size = ImVec2{304 * 4, 176 * 4};
@@ -526,6 +530,8 @@ auto Sorcery::Render::_load_tile_views() -> void {
 
 		_set_texture_coordinates(tileview);
 	}
+
+	_wireframe.build(_tileviews, _source_size);
 }
 
 auto Sorcery::Render::_get_left_side(const Enums::Map::Direction facing) const
@@ -604,18 +610,30 @@ auto Sorcery::Render::_has_wall(
 	return ((tile.has(direction, WALL)) || (tile.has(direction, ONE_WAY_WALL)));
 }
 
+// The textured view is used if it is turned on and the current level's geometry
+// has been built, otherwise we draw the wireframe as normal
 auto Sorcery::Render::draw(Game *game, Component *component) -> void {
 
+	if (_dungeon_view.is_available()) {
+		const auto &level{*game->state->level};
+		_dungeon_view.prepare(level);
+		if (_dungeon_view.is_ready(level.depth())) {
+			_render_textured(game, component);
+			return;
+		}
+	}
+
 	_render_wireframe(game, component);
 }
 
-auto Sorcery::Render::_render_wireframe(Game *game, Component *component)
-	-> void {
+auto Sorcery::Render::prepare(const Level &level) -> void {
+
+	_dungeon_view.prepare(level);
+}
+
+auto Sorcery::Render::_get_view_pos(const Component *component,
+									const float scale) const -> ImVec2 {
 
-	const auto player_pos{game->state->get_player_pos()};
-	const auto player_facing{game->state->get_player_facing()};
-	// const auto scale{std::stof((*component)["scale"].value())};
-	const auto scale{1.0f};
 	const auto width{scale * _pane_size.x};
 	const auto height{scale * _pane_size.y};
 	const auto x{std::invoke([&] {
@@ -632,43 +650,73 @@ auto Sorcery::Render::_render_wireframe(Game *game, Component *component)
 		} else
 			return static_cast<float>(height);
 	})};
-	const ImVec2 pos{x, y};
+
+	return ImVec2{x, y};
+}
+
+auto Sorcery::Render::_render_textured(Game *game, Component *component)
+	-> void {
+
+	PROFILE_SCOPE("Render::_render_textured");
+
+	const auto scale{1.0f};
+	_ui->draw_view_textured(&_dungeon_view, game,
+							_get_view_pos(component, scale),
+							ImVec2{scale * _pane_size.x, scale * _pane_size.y},
+							_system->animation->fade, _monochrome);
+}
+
+auto Sorcery::Render::_render_wireframe(Game *game, Component *component)
+	-> void {
+
+	PROFILE_SCOPE("Render::_render_wireframe");
+
+	const auto player_pos{game->state->get_player_pos()};
+	const auto player_facing{game->state->get_player_facing()};
+	// const auto scale{std::stof((*component)["scale"].value())};
+	const auto scale{1.0f};
+	const auto pos{_get_view_pos(component, scale)};
+
+	// Visible quads are collected and then drawn in one go where possible
+	_use_wireframe = _wireframe.is_available();
+	if (_use_wireframe)
+		_wireframe.begin(pos, scale);
 
 	// TODO - change level at to use z- into the screen
 	const auto tl0{game->state->level->at(player_pos, player_facing, -1, 0)};
-	auto vl0{_tileviews.at(Coordinate3{-1, 0, 0})};
+	const auto &vl0{_tileviews.at(Coordinate3{-1, 0, 0})};
 	const auto tm0{game->state->level->at(player_pos, player_facing, 0, 0)};
-	auto vm0{_tileviews.at(Coordinate3{0, 0, 0})};
+	const auto &vm0{_tileviews.at(Coordinate3{0, 0, 0})};
 	const auto tr0{game->state->level->at(player_pos, player_facing, 1, 0)};
-	auto vr0{_tileviews.at(Coordinate3{1, 0, 0})};
+	const auto &vr0{_tileviews.at(Coordinate3{1, 0, 0})};
 
 	const auto tl1{game->state->level->at(player_pos, player_facing, -1, 1)};
-	auto vl1{_tileviews.at(Coordinate3{-1, 0, -1})};
+	const auto &vl1{_tileviews.at(Coordinate3{-1, 0, -1})};
 	const auto tm1{game->state->level->at(player_pos, player_facing, 0, 1)};
-	auto vm1{_tileviews.at(Coordinate3{0, 0, -1})};
+	const auto &vm1{_tileviews.at(Coordinate3{0, 0, -1})};
 	const auto tr1{game->state->level->at(player_pos, player_facing, 1, 1)};
-	auto vr1{_tileviews.at(Coordinate3{1, 0, -1})};
+	const auto &vr1{_tileviews.at(Coordinate3{1, 0, -1})};
 
 	const auto tl2{game->state->level->at(player_pos, player_facing, -1, 2)};
-	auto vl2{_tileviews.at(Coordinate3{-1, 0, -2})};
+	const auto &vl2{_tileviews.at(Coordinate3{-1, 0, -2})};
 	const auto tm2{game->state->level->at(player_pos, player_facing, 0, 2)};
-	auto vm2{_tileviews.at(Coordinate3{0, 0, -2})};
+	const auto &vm2{_tileviews.at(Coordinate3{0, 0, -2})};
 	const auto tr2{game->state->level->at(player_pos, player_facing, 1, 2)};
-	auto vr2{_tileviews.at(Coordinate3{1, 0, -2})};
+	const auto &vr2{_tileviews.at(Coordinate3{1, 0, -2})};
 
 	const auto tl3{game->state->level->at(player_pos, player_facing, -1, 3)};
-	auto vl3{_tileviews.at(Coordinate3{-1, 0, -3})};
+	const auto &vl3{_tileviews.at(Coordinate3{-1, 0, -3})};
 	const auto tm3{game->state->level->at(player_pos, player_facing, 0, 3)};
-	auto vm3{_tileviews.at(Coordinate3{0, 0, -3})};
+	const auto &vm3{_tileviews.at(Coordinate3{0, 0, -3})};
 	const auto tr3{game->state->level->at(player_pos, player_facing, 1, 3)};
-	auto vr3{_tileviews.at(Coordinate3{1, 0, -3})};
+	const auto &vr3{_tileviews.at(Coordinate3{1, 0, -3})};
 
 	const auto tl4{game->state->level->at(player_pos, player_facing, -1, 4)};
-	auto vl4{_tileviews.at(Coordinate3{-1, 0, -4})};
+	const auto &vl4{_tileviews.at(Coordinate3{-1, 0, -4})};
 	const auto tm4{game->state->level->at(player_pos, player_facing, 0, 4)};
-	auto vm4{_tileviews.at(Coordinate3{0, 0, -4})};
+	const auto &vm4{_tileviews.at(Coordinate3{0, 0, -4})};
 	const auto tr4{game->state->level->at(player_pos, player_facing, 1, 4)};
-	auto vr4{_tileviews.at(Coordinate3{1, 0, -4})};
+	const auto &vr4{_tileviews.at(Coordinate3{1, 0, -4})};
 
 	// If we are in darkness, only draw that!
 	if (tm0.is(Enums::Tile::Properties::DARKNESS)) {
@@ -1053,12 +1101,23 @@ auto Sorcery::Render::_render_wireframe(Game *game, Component *component)
 			}
 		}
 	}
+
+	if (_use_wireframe)
+		_ui->draw_view_wireframe(&_wireframe, _system->animation->fade,
+								 _monochrome);
 }
 
 auto Sorcery::Render::_draw_vertex_array(const VertexArray &array,
 										 const float scale, const ImVec2 pos)
 	-> void {
 
+	if (_use_wireframe) {
+		_wireframe.add(array);
+		return;
+	}
+
+	// Otherwise draw each quad as an ImGui image
+
 	// Work out the Quad (Rect) on the Screen where we are going to draw!
 	const ImVec2 p1{pos.x + (array.data[0].position.x * scale),
 					pos.y + (array.data[0].position.y * scale)};
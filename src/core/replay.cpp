@@ -0,0 +1,197 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/replay.hpp"
+
+Sorcery::Replay::Replay()
+	: _mode{Mode::NONE},
+	  _timed{false},
+	  _frame{0},
+	  _epoch{std::chrono::steady_clock::now()},
+	  _ticks{0},
+	  _next{0},
+	  _finished{false} {}
+
+// There is only ever the one, as every event loop polls through it
+auto Sorcery::Replay::get() -> Replay & {
+
+	static Replay replay{};
+
+	return replay;
+}
+
+// Events are written as they arrive, so a crash still leaves a usable file
+auto Sorcery::Replay::record(const std::filesystem::path &path,
+							 const std::uint64_t seed) -> bool {
+
+	_file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!_file.good())
+		return false;
+
+	const ReplayHeader header{REPLAY_MAGIC, REPLAY_VERSION,
+							  static_cast<std::uint32_t>(sizeof(SDL_Event)),
+							  seed};
+	_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	_mode = Mode::RECORD;
+	_frame = 0;
+	_epoch = std::chrono::steady_clock::now();
+	_ticks = SDL_GetTicks64();
+	_write_ticks();
+	std::atexit([] { Replay::get().stop(); });
+
+	return _file.good();
+}
+
+// Returns the seed that the recording was made with
+auto Sorcery::Replay::replay(const std::filesystem::path &path,
+							 const bool timed) -> std::optional<std::uint64_t> {
+
+	std::ifstream file{path, std::ios::in | std::ios::binary};
+	ReplayHeader header{};
+	if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+		header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION ||
+		header.event_size != sizeof(SDL_Event))
+		return std::nullopt;
+
+	_events.clear();
+	_frame_ticks.clear();
+	for (ReplayEvent event{}; file.read(reinterpret_cast<char *>(&event),
+										sizeof(event));)
+		if (event.event.type != SDL_FIRSTEVENT)
+			_events.push_back(event);
+		else if (event.frame == _frame_ticks.size())
+			_frame_ticks.push_back(static_cast<std::uint64_t>(event.time));
+
+	_mode = Mode::REPLAY;
+	_timed = timed;
+	_next = 0;
+	_frame = 0;
+	_finished = false;
+	_epoch = std::chrono::steady_clock::now();
+	_ticks = _frame_ticks.empty() ? SDL_GetTicks64() : _frame_ticks.front();
+
+	return header.seed;
+}
+
+// Use in place of SDL_PollEvent. When replaying, real input is thrown away
+// (apart from closing the window) and recorded events are handed out once
+// their frame (or time) comes round; after the last of them (and the last
+// recorded frame) we hand out a quit
+auto Sorcery::Replay::poll(SDL_Event *event) -> bool {
+
+	if (_mode != Mode::REPLAY) {
+		if (!SDL_PollEvent(event))
+			return false;
+
+		if (_mode == Mode::RECORD && _is_recordable(*event)) {
+			const ReplayEvent recorded{_frame, _now(), *event};
+			_file.write(reinterpret_cast<const char *>(&recorded),
+						sizeof(recorded));
+		}
+
+		return true;
+	}
+
+	while (SDL_PollEvent(event))
+		if (event->type == SDL_QUIT)
+			return true;
+
+	if (_next == _events.size()) {
+		if (_finished || (!_timed && _frame + 1 < _frame_ticks.size()))
+			return false;
+
+		std::println("Replay finished after {} frames", _frame);
+		_finished = true;
+		*event = SDL_Event{};
+		event->type = SDL_QUIT;
+
+		return true;
+	}
+
+	const auto &next{_events[_next]};
+	if (_timed ? next.time > _now() : next.frame > _frame)
+		return false;
+
+	*event = next.event;
+	++_next;
+
+	return true;
+}
+
+// Called once a frame (main thread only); this is also when the scheduler
+// clock moves on
+auto Sorcery::Replay::next_frame() -> void {
+
+	++_frame;
+	if (_mode == Mode::RECORD) {
+		_ticks = SDL_GetTicks64();
+		_write_ticks();
+	} else if (_mode == Mode::REPLAY && _frame < _frame_ticks.size())
+		_ticks = _frame_ticks[_frame];
+}
+
+// Use in place of SDL_GetTicks64 for anything that affects the game (a timed
+// replay isn't exact anyway, so just uses the real clock)
+auto Sorcery::Replay::get_ticks() const -> std::uint64_t {
+
+	if (_mode == Mode::RECORD || (_mode == Mode::REPLAY && !_timed))
+		return _ticks;
+
+	return SDL_GetTicks64();
+}
+
+auto Sorcery::Replay::stop() -> void {
+
+	if (_mode == Mode::RECORD)
+		_file.close();
+	_mode = Mode::NONE;
+}
+
+auto Sorcery::Replay::_now() const -> std::int64_t {
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			   std::chrono::steady_clock::now() - _epoch)
+		.count();
+}
+
+auto Sorcery::Replay::_write_ticks() -> void {
+
+	ReplayEvent ticks{_frame, static_cast<std::int64_t>(_ticks), SDL_Event{}};
+	ticks.event.type = SDL_FIRSTEVENT;
+	_file.write(reinterpret_cast<const char *>(&ticks), sizeof(ticks));
+}
+
+// Leave out anything that carries a pointer, as that won't survive the trip
+auto Sorcery::Replay::_is_recordable(const SDL_Event &event) const -> bool {
+
+	switch (event.type) {
+	case SDL_DROPFILE:
+	case SDL_DROPTEXT:
+	case SDL_SYSWMEVENT:
+#if SDL_VERSION_ATLEAST(2, 0, 22)
+	case SDL_TEXTEDITING_EXT:
+#endif
+		return false;
+	default:
+		return event.type < SDL_USEREVENT;
+	}
+}
@@ -32,4 +32,8 @@ Sorcery::Resources::Resources(System *system)
 	levels =
 		std::make_unique<LevelStore>(_system, (*_system->files)[MAPS_FILE]);
 	spells = std::make_unique<SpellStore>(_system);
+
+	// Built from the stores above, so must come after them
+	loot = std::make_unique<LootTable>(_system, *items);
+	encounters = std::make_unique<EncounterTable>(_system, *monsters);
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/scheduler.hpp"
+#include "core/replay.hpp"
+
+Sorcery::Scheduler::Scheduler() {
+
+	_deadlines.clear();
+	_timers.clear();
+	_next_id = 1;
+}
+
+auto Sorcery::Scheduler::add(const Uint32 interval, SDL_TimerCallback callback,
+							 void *param) -> SDL_TimerID {
+
+	const auto id{_next_id++};
+	_timers[id] = Timer{callback, param, interval};
+	_push(id, Replay::get().get_ticks() + interval);
+
+	return id;
+}
+
+auto Sorcery::Scheduler::remove(const SDL_TimerID id) -> bool {
+
+	return _timers.erase(id) > 0;
+}
+
+// Run every timer that has come due; a timer that returns a non-zero interval
+// is rescheduled relative to its previous deadline so that ticks don't drift.
+// Time comes from the replay clock, so that recordings play back exactly
+auto Sorcery::Scheduler::update() -> void {
+
+	const auto now{Replay::get().get_ticks()};
+	while (!_deadlines.empty() && _deadlines.front().when <= now) {
+
+		std::ranges::pop_heap(_deadlines, std::greater<>{});
+		const auto deadline{_deadlines.back()};
+		_deadlines.pop_back();
+
+		if (!_timers.contains(deadline.id))
+			continue;
+
+		// Copy since the callback is allowed to add or remove timers
+		const auto timer{_timers.at(deadline.id)};
+		const auto interval{timer.callback(timer.interval, timer.param)};
+		if (!_timers.contains(deadline.id))
+			continue;
+
+		if (interval == 0)
+			remove(deadline.id);
+		else {
+			// If we've fallen behind (e.g. a long load) don't try and catch up
+			const auto next{deadline.when + interval};
+			_timers.at(deadline.id).interval = interval;
+			_push(deadline.id, next > now ? next : now + interval);
+		}
+	}
+}
+
+auto Sorcery::Scheduler::_push(const SDL_TimerID id, const Uint64 when)
+	-> void {
+
+	_deadlines.push_back(Deadline{when, id});
+	std::ranges::push_heap(_deadlines, std::greater<>{});
+}
@@ -38,7 +38,12 @@ Sorcery::System::System(int argc __attribute__((unused)),
 
 	config = std::make_unique<Config>(_settings.get(), (*files)[CONFIG_FILE]);
 	random = std::make_unique<Random>();
-	animation = std::make_unique<Animation>(random.get());
+
+	// Animation threads get their own RNG, so that they neither race the game
+	// for it nor upset the sequence of rolls when replaying
+	_animation_random = std::make_unique<Random>();
+	animation = std::make_unique<Animation>(_animation_random.get());
+	scheduler = std::make_unique<Scheduler>();
 	db = std::make_unique<Database>(CSTR((*files)[DATABASE_FILE]));
 }
 
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/threadpool.hpp"
+#include "core/trace.hpp"
+
+Sorcery::ThreadPool::ThreadPool(const unsigned int threads)
+	: _job{nullptr},
+	  _generation{0},
+	  _remaining{0},
+	  _stop{false} {
+
+	const auto count{threads > 0
+						 ? threads
+						 : std::max(std::thread::hardware_concurrency(), 1u)};
+	for (auto worker = 0u; worker < count; worker++)
+		_queues.push_back(std::make_unique<Queue>());
+	for (auto worker = 0u; worker < count; worker++)
+		_workers.emplace_back([this, worker] { _work(worker); });
+}
+
+Sorcery::ThreadPool::~ThreadPool() {
+
+	{
+		std::scoped_lock<std::mutex> scoped_lock(_mutex);
+		_stop = true;
+	}
+	_wake.notify_all();
+}
+
+auto Sorcery::ThreadPool::size() const -> unsigned int {
+
+	return static_cast<unsigned int>(_workers.size());
+}
+
+// Calls job(index, worker) for every index in [0, count) and waits for them
+// all to finish; indexes are handed out in chunks, dealt round the workers
+auto Sorcery::ThreadPool::parallel_for(
+	const std::size_t count, const std::size_t chunk,
+	const std::function<void(std::size_t, unsigned int)> &job) -> void {
+
+	if (count == 0)
+		return;
+
+	const auto step{std::max<std::size_t>(chunk, 1)};
+	std::unique_lock<std::mutex> lock(_mutex);
+	_job = &job;
+	_remaining = 0;
+	for (std::size_t first = 0; first < count; first += step) {
+		auto &queue{*_queues[_remaining % _queues.size()]};
+		std::scoped_lock<std::mutex> queue_lock(queue.mutex);
+		queue.ranges.push_back(Range{first, std::min(first + step, count)});
+		++_remaining;
+	}
+	++_generation;
+	_wake.notify_all();
+	_done.wait(lock, [this] { return _remaining == 0; });
+	_job = nullptr;
+}
+
+auto Sorcery::ThreadPool::_work(const unsigned int worker) -> void {
+
+	Trace::get().set_thread_name(std::format("worker {}", worker));
+	auto generation{0ull};
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wake.wait(lock,
+					   [&] { return _stop || _generation != generation; });
+			if (_stop)
+				return;
+			generation = _generation;
+		}
+
+		while (const auto range{_pop(worker)}) {
+			for (auto index = range->first; index < range->last; index++)
+				(*_job)(index, worker);
+
+			std::scoped_lock<std::mutex> scoped_lock(_mutex);
+			if (--_remaining == 0)
+				_done.notify_all();
+		}
+	}
+}
+
+// Our own queue first, newest range first; otherwise the oldest range from
+// the next worker along that has any
+auto Sorcery::ThreadPool::_pop(const unsigned int worker)
+	-> std::optional<Range> {
+
+	{
+		auto &queue{*_queues[worker]};
+		std::scoped_lock<std::mutex> scoped_lock(queue.mutex);
+		if (!queue.ranges.empty()) {
+			const auto range{queue.ranges.back()};
+			queue.ranges.pop_back();
+			return range;
+		}
+	}
+
+	for (auto offset = 1u; offset < _queues.size(); offset++) {
+		auto &queue{*_queues[(worker + offset) % _queues.size()]};
+		std::scoped_lock<std::mutex> scoped_lock(queue.mutex);
+		if (!queue.ranges.empty()) {
+			const auto range{queue.ranges.front()};
+			queue.ranges.pop_front();
+			return range;
+		}
+	}
+
+	return std::nullopt;
+}
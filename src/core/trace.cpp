@@ -0,0 +1,191 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/trace.hpp"
+
+namespace {
+
+// The buffer for this thread, once it has recorded anything
+thread_local void *thread_buffer{nullptr};
+
+// Event names are our own string literals, but escape them anyway
+auto escape(std::string_view text) -> std::string {
+
+	std::string escaped{};
+	escaped.reserve(text.size());
+	for (const auto c : text) {
+		if (c == '"' || c == '\\')
+			escaped.push_back('\\');
+		escaped.push_back(c);
+	}
+
+	return escaped;
+}
+
+} // namespace
+
+Sorcery::Trace::Trace()
+	: _enabled{false},
+	  _epoch{std::chrono::steady_clock::now()} {}
+
+// There is only ever the one, as scopes can be anywhere in the code
+auto Sorcery::Trace::get() -> Trace & {
+
+	static Trace trace{};
+
+	return trace;
+}
+
+// The trace is also written if we exit early (for example on an error)
+auto Sorcery::Trace::start(const std::filesystem::path &path) -> void {
+
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+	_path = path;
+	_epoch = std::chrono::steady_clock::now();
+	_enabled.store(true, std::memory_order_release);
+	std::atexit([] { Trace::get().stop(); });
+}
+
+// Write everything recorded so far, once all the worker threads have stopped
+auto Sorcery::Trace::stop() -> void {
+
+	if (!_enabled.exchange(false, std::memory_order_acq_rel))
+		return;
+
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+	if (!_write())
+		std::cerr << std::format("Unable to write trace to '{}'!",
+								 _path.string())
+				  << std::endl;
+}
+
+auto Sorcery::Trace::is_enabled() const -> bool {
+
+	return _enabled.load(std::memory_order_relaxed);
+}
+
+auto Sorcery::Trace::now() const -> std::int64_t {
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			   std::chrono::steady_clock::now() - _epoch)
+		.count();
+}
+
+auto Sorcery::Trace::add(const char *name, const std::int64_t start,
+						 const std::int64_t end,
+						 const AllocationCount allocations) -> void {
+
+	if (!is_enabled())
+		return;
+
+	// Stop recording (rather than growing forever) if left running for ages
+	auto &buffer{_get_buffer()};
+	std::scoped_lock<std::mutex> scoped_lock(buffer.mutex);
+	if (buffer.events.size() < TRACE_MAX_EVENTS)
+		buffer.events.push_back(
+			TraceEvent{name, start, end - start, allocations});
+}
+
+auto Sorcery::Trace::set_thread_name(std::string_view name) -> void {
+
+	if (!is_enabled())
+		return;
+
+	auto &buffer{_get_buffer()};
+	std::scoped_lock<std::mutex> scoped_lock(buffer.mutex);
+	buffer.name = name;
+}
+
+// Only the first event on each thread needs the lock
+auto Sorcery::Trace::_get_buffer() -> TraceBuffer & {
+
+	if (thread_buffer == nullptr) {
+		std::scoped_lock<std::mutex> scoped_lock(_mutex);
+		auto buffer{std::make_unique<TraceBuffer>()};
+		buffer->id = static_cast<std::uint32_t>(_buffers.size() + 1);
+		buffer->name = std::format("thread {}", buffer->id);
+		buffer->events.reserve(TRACE_RESERVE_EVENTS);
+		thread_buffer = buffer.get();
+		_buffers.push_back(std::move(buffer));
+	}
+
+	return *static_cast<TraceBuffer *>(thread_buffer);
+}
+
+// Each buffer is taken as it stands, so threads still recording (e.g. when
+// exiting early) can carry on safely; anything after that is dropped
+auto Sorcery::Trace::_write() -> bool {
+
+	std::ofstream file{_path, std::ios::out | std::ios::trunc};
+	if (!file.good())
+		return false;
+
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	const auto tracking{Allocations::is_tracking()};
+	auto first{true};
+	std::vector<TraceEvent> events{};
+	for (const auto &buffer : _buffers) {
+		std::string name{};
+		{
+			std::scoped_lock<std::mutex> scoped_lock(buffer->mutex);
+			name = buffer->name;
+			events.clear();
+			events.swap(buffer->events);
+		}
+
+		file << (first ? "" : ",")
+			 << std::format("\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+							"1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+							buffer->id, escape(name));
+		first = false;
+		for (const auto &event : events) {
+			file << std::format(
+				",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},"
+				"\"ts\":{},\"dur\":{}",
+				escape(event.name), buffer->id, event.start, event.duration);
+			if (tracking)
+				file << std::format(
+					",\"args\":{{\"allocations\":{},\"bytes\":{}}}",
+					event.allocations.count, event.allocations.bytes);
+			file << "}";
+		}
+	}
+	file << "\n]}\n";
+
+	return file.good();
+}
+
+Sorcery::TraceScope::TraceScope(const char *name)
+	: _name{name},
+	  _start{Trace::get().is_enabled() ? Trace::get().now() : -1},
+	  _allocations{Allocations::get_thread()} {}
+
+Sorcery::TraceScope::~TraceScope() {
+
+	if (_start >= 0) {
+		const auto allocations{Allocations::get_thread()};
+		Trace::get().add(
+			_name, _start, Trace::get().now(),
+			AllocationCount{allocations.count - _allocations.count,
+							allocations.bytes - _allocations.bytes});
+	}
+}
@@ -22,11 +22,17 @@
 
 #include "core/ui.hpp"
 #include "common/macro.hpp"
+#include "core/allocations.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/dungeonview.hpp"
+#include "core/profiler.hpp"
 #include "core/render.hpp"
+#include "core/replay.hpp"
 #include "core/resources.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
+#include "core/wireframe.hpp"
 #include "gui/dialog.hpp"
 #include "gui/frame.hpp"
 #include "gui/input.hpp"
@@ -40,8 +46,10 @@
 #include "resources/levelstore.hpp"
 #include "resources/monsterstore.hpp"
 #include "resources/spellstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "types/component.hpp"
 #include "types/enum.hpp"
+#include "types/event.hpp"
 #include "types/game.hpp"
 #include "types/state.hpp"
 
@@ -55,7 +63,10 @@ Sorcery::UI::UI(System *system, Display *display, Resources *resources,
 	// Storage
 	components =
 		std::make_unique<ComponentStore>((*_system->files)[LAYOUT_FILE]);
+	_system->strings->check(LAYOUT_FILE, components->get_string_keys());
+	_system->strings->check("code", CODE_STRING_KEYS);
 	images = std::make_unique<ImageStore>(_system);
+	_icons_image = images->handle(ICONS_TEXTURE);
 
 	// Custom Components
 	dialog_exit = std::make_unique<Dialog>(
@@ -132,6 +143,59 @@ auto Sorcery::UI::set_monochrome(const bool value) -> void {
 	_render->set_monochrome(value);
 }
 
+// Called on arriving at a level so the textured view can get it ready early
+auto Sorcery::UI::prepare_view(const Level &level) -> void {
+
+	_render->prepare(level);
+}
+
+// Whether there is anything to draw for the screen (only valid after start)
+auto Sorcery::UI::has_screen(const std::string &screen) const -> bool {
+
+	const auto screens{get_screens()};
+
+	return screen == "engine" ||
+		   std::ranges::find(screens, screen) != screens.end();
+}
+
+// Every screen that can be drawn by name (apart from the engine); those after
+// the frontend and module screens also need a mode, or the license text
+auto Sorcery::UI::get_screens() const -> std::vector<std::string> {
+
+	std::vector<std::string> screens{};
+	for (const auto &[screen, draw] : _draw_frontend)
+		screens.emplace_back(screen);
+	for (const auto &[screen, draw] : _draw_modules)
+		screens.emplace_back(screen);
+	for (const auto screen : {"roster", "inspect", "heal", "choose", "reorder",
+							  "recovery", "levelup", "nolevelup", "license"})
+		screens.emplace_back(screen);
+
+	return screens;
+}
+
+// Only valid between one frame being rendered and the next starting
+auto Sorcery::UI::get_draw_stats() const -> DrawStats {
+
+	DrawStats stats{0, 0, 0};
+	if (const auto data{ImGui::GetDrawData()}; data != nullptr && data->Valid) {
+		stats.vertices = data->TotalVtxCount;
+		stats.indices = data->TotalIdxCount;
+		for (auto i = 0; i < data->CmdListsCount; i++)
+			for (const auto &cmd : data->CmdLists[i]->CmdBuffer)
+				if (cmd.UserCallback == nullptr)
+					++stats.draw_calls;
+	}
+
+	return stats;
+}
+
+// Module screens are drawn with a Game, frontend screens without
+auto Sorcery::UI::is_module(const std::string &screen) const -> bool {
+
+	return _draw_modules.contains(screen);
+}
+
 // Create a Modal on Demand (used whenever data items on it aren't fixed - for
 // example the Party Members); normally otherwise fixed Modals are created at
 // the beginning as part of the Form/Module create
@@ -199,6 +263,7 @@ auto Sorcery::UI::create_dynamic_modal(Game *game, const std::string name)
 auto Sorcery::UI::load_fonts() -> void {
 
 	fonts.clear();
+	text_cache.invalidate();
 	auto font_size{std::stof((*_system->config).get("Font", "size"))};
 	if (adj_grid_w > font_size)
 		font_size = adj_grid_w;
@@ -444,10 +509,19 @@ auto Sorcery::UI::_setup_draw_modules() -> void {
 
 auto Sorcery::UI::display_engine(Game *game) -> void {
 
+	PROFILE_FRAME();
+	Replay::get().next_frame();
+	PROFILE_SCOPE("UI::display_engine");
+	TRACE_SCOPE("frame");
+
+	// Fire any timers that have come due (on this, the main, thread)
+	_system->scheduler->update();
+
 	// Start a new Rendering Frame
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui_ImplSDL2_NewFrame();
 	ImGui::NewFrame();
+	images->next_frame();
 
 	_setup_windows();
 
@@ -484,6 +558,8 @@ auto Sorcery::UI::display_engine(Game *game) -> void {
 		_draw_icons(game);
 		_draw_save(game);
 	}
+	if (game->get_console_status())
+		_draw_console(game);
 
 	// Dungeon View
 	auto component{(*components)["engine_base_ui:wire_frame_view"]};
@@ -504,18 +580,30 @@ auto Sorcery::UI::display_engine(Game *game) -> void {
 	glClear(GL_COLOR_BUFFER_BIT);
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 	SDL_GL_SwapWindow(_display->get_SDL_window());
+
+	// Check the frame against any allocation budget
+	Allocations::check_frame("engine");
 }
 
 auto Sorcery::UI::display(const std::string screen, std::any first,
 						  std::any second) -> void {
 
+	PROFILE_FRAME();
+	Replay::get().next_frame();
+	PROFILE_SCOPE("UI::display");
+	TRACE_SCOPE("frame");
+
 	// Store what we want to draw
 	_controller->last = screen;
 
+	// Fire any timers that have come due (on this, the main, thread)
+	_system->scheduler->update();
+
 	// Start a new Rendering Frame
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui_ImplSDL2_NewFrame();
 	ImGui::NewFrame();
+	images->next_frame();
 
 	_setup_windows();
 
@@ -571,6 +659,9 @@ auto Sorcery::UI::display(const std::string screen, std::any first,
 	glClear(GL_COLOR_BUFFER_BIT);
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 	SDL_GL_SwapWindow(_display->get_SDL_window());
+
+	// Check the frame against any allocation budget
+	Allocations::check_frame(screen);
 }
 
 // Preset all the (transparent) windows we will need (this should be called
@@ -643,28 +734,56 @@ auto Sorcery::UI::draw_view_image(std::string_view source,
 	with_Window(WINDOW_LAYER_VIEW, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 
-		// Load the image if necessary
-		if (!images->has_loaded(std::string{source}))
-			images->load_image(std::string{source});
+		// Loads the image if necessary
+		const auto &src_image{images->get(source)};
 
 		ImDrawList *draw_list{ImGui::GetWindowDrawList()};
 		auto old_flags{draw_list->Flags};
 		draw_list->Flags = ImDrawListFlags_None;
-		auto src_image{images->get(std::string{source})};
 		draw_list->AddImageQuad(
 			src_image.texture,
 			ImVec2{array.data[0].position.x, array.data[0].position.y},
 			ImVec2{array.data[1].position.x, array.data[1].position.y},
 			ImVec2{array.data[2].position.x, array.data[2].position.y},
 			ImVec2{array.data[3].position.x, array.data[3].position.y},
-			ImVec2{array.data[0].tex_coord.x, array.data[0].tex_coord.y},
-			ImVec2{array.data[1].tex_coord.x, array.data[1].tex_coord.y},
-			ImVec2{array.data[2].tex_coord.x, array.data[2].tex_coord.y},
-			ImVec2{array.data[3].tex_coord.x, array.data[3].tex_coord.y},
+			src_image.uv(array.data[0].tex_coord),
+			src_image.uv(array.data[1].tex_coord),
+			src_image.uv(array.data[2].tex_coord),
+			src_image.uv(array.data[3].tex_coord),
 			ImGui::ColorConvertFloat4ToU32(array.data[0].colour));
 		draw_list->Flags = old_flags;
 	}
 }
+
+// Queue the dungeon view to be drawn by the shader renderer on the view layer
+auto Sorcery::UI::draw_view_wireframe(Wireframe *wireframe, const float fade,
+									 const bool monochrome) -> void {
+
+	with_Window(WINDOW_LAYER_VIEW, nullptr,
+				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
+
+		const auto &src_image{images->get(WIREFRAME_TEXTURE)};
+		wireframe->submit(ImGui::GetWindowDrawList(), src_image, fade,
+						  monochrome);
+	}
+}
+
+// Queue the textured dungeon view to be drawn on the view layer
+auto Sorcery::UI::draw_view_textured(DungeonView *dungeon_view, Game *game,
+									const ImVec2 pos, const ImVec2 size,
+									const float fade, const bool monochrome)
+	-> void {
+
+	with_Window(WINDOW_LAYER_VIEW, nullptr,
+				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
+
+		dungeon_view->submit(
+			ImGui::GetWindowDrawList(), game->state->get_depth(),
+			game->state->get_player_pos(), game->state->get_player_facing(),
+			pos, size, fade, monochrome, game->state->get_lit());
+	}
+}
+
 // Handle drawing parts of a texture as specified by a tile index
 auto Sorcery::UI::_draw_fg_image_with_idx(std::string_view layer,
 										  std::string_view source,
@@ -675,7 +794,7 @@ auto Sorcery::UI::_draw_fg_image_with_idx(std::string_view layer,
 	auto tile_row_count{0};
 	auto tile_size{0};
 	auto image_size{ImVec2{0, 0}};
-	auto src_image{images->get(std::string{source})};
+	const auto &src_image{images->get(source)};
 	if (source == KNOWN_CREATURES_TEXTURE ||
 		source == UNKNOWN_CREATURES_TEXTURE) {
 		tile_row_count = CREATURE_TILE_ROW_COUNT;
@@ -703,14 +822,14 @@ auto Sorcery::UI::_draw_fg_image_with_idx(std::string_view layer,
 	const auto from{ImVec4{tile_size * (idx % tile_row_count),
 						   tile_size * (idx / tile_row_count), tile_size,
 						   tile_size}};
-	const auto uv_0{ImVec2{from.x / image_size.x, from.y / image_size.y}};
-	const auto uv_1{ImVec2{(from.x + tile_size) / image_size.x,
-						   (from.y + tile_size) / image_size.y}};
+	const auto uv_0{src_image.uv(
+		ImVec2{from.x / image_size.x, from.y / image_size.y})};
+	const auto uv_1{src_image.uv(ImVec2{(from.x + tile_size) / image_size.x,
+										(from.y + tile_size) / image_size.y})};
 
 	with_Window(std::string(layer).c_str(), nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 		ImGui::SetCursorPos(ImVec2{p_min});
-		auto src_image{images->get(std::string{source})};
 		ImVec4 tint_col{
 			ImVec4(tint.x, tint.y, tint.z, _system->animation->fade)};
 		ImGui::Image((intptr_t)src_image.texture, p_sz, uv_0, uv_1, tint_col);
@@ -733,12 +852,8 @@ auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
 		const auto source{(*component)["source"].value()};
 		const auto scale{std::stof((*component)["scale"].value())};
 
-		// Load the image if necessary
-		if (!images->has_loaded(source))
-			images->load_image(source);
-
-		// Work out any scaling if needed
-		auto src_image{images->get(source)};
+		// Work out any scaling if needed (loading the image if necessary)
+		const auto &src_image{images->get(source)};
 		const auto resized{Size{(intptr_t)src_image.width * scale,
 								(intptr_t)src_image.height * scale}};
 
@@ -766,7 +881,7 @@ auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
 			ImGui::Image(src_image.texture,
 						 ImVec2{static_cast<float>(resized.w),
 								static_cast<float>(resized.h)},
-						 ImVec2{0.0f, 0.0f}, ImVec2{1.0f, 1.0f}, tint_col);
+						 src_image.uv_min, src_image.uv_max, tint_col);
 		}
 	}
 }
@@ -777,20 +892,15 @@ auto Sorcery::UI::_draw_bg_image(Component *component) -> void {
 
 		// Load the image if necessary
 		const auto source{(*component)["source"].value()};
-		if (!images->has_loaded(source))
-			images->load_image(source);
-
 		const auto viewport{ImGui::GetMainViewport()};
-		auto src_image{images->get(source)};
-		const auto size{
-			Size((intptr_t)src_image.width, (intptr_t)src_image.height)};
+		const auto &src_image{images->get(source)};
 
 		// Draw the Image
 		with_Window(WINDOW_LAYER_BG, nullptr,
 					ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 			ImGui::SetCursorPos(ImVec2{0, 0});
 			ImGui::Image((intptr_t)src_image.texture, viewport->Size,
-						 ImVec2{0.0f, 0.0f}, ImVec2{1.0f, 1.0f});
+						 src_image.uv_min, src_image.uv_max);
 		}
 	}
 }
@@ -804,7 +914,7 @@ auto Sorcery::UI::draw_cursor(const bool value) -> void {
 auto Sorcery::UI::_draw_cursor() -> void {
 
 	// Just check if we can draw
-	if (!images->has_loaded(std::string{ICONS_TEXTURE})) {
+	if (!images->has_loaded(_icons_image)) {
 		ImGui::SetMouseCursor(ImGuiMouseCursor_Arrow);
 		return;
 	} else
@@ -821,7 +931,7 @@ auto Sorcery::UI::_draw_cursor() -> void {
 		// no matter what)
 
 		// Work out what cursor to draw
-		auto src_image{images->get(std::string{ICONS_TEXTURE})};
+		const auto &src_image{images->get(_icons_image)};
 		const auto icon_sz{src_image.width / ICONS_TILE_ROW_COUNT};
 		const auto texture_sz{ImVec2{src_image.width, src_image.height}};
 		const auto dest_sz{ImVec2{32, 32}};
@@ -838,9 +948,11 @@ auto Sorcery::UI::_draw_cursor() -> void {
 		const auto from{ImVec4{icon_sz * (cursor_idx % ICONS_TILE_ROW_COUNT),
 							   icon_sz * (cursor_idx / ICONS_TILE_ROW_COUNT),
 							   icon_sz, icon_sz}};
-		const auto uv_0{ImVec2{from.x / texture_sz.x, from.y / texture_sz.y}};
-		const auto uv_1{ImVec2{(from.x + icon_sz) / texture_sz.x,
-							   (from.y + icon_sz) / texture_sz.y}};
+		const auto uv_0{src_image.uv(
+			ImVec2{from.x / texture_sz.x, from.y / texture_sz.y})};
+		const auto uv_1{
+			src_image.uv(ImVec2{(from.x + icon_sz) / texture_sz.x,
+								(from.y + icon_sz) / texture_sz.y})};
 
 		ImGui::GetForegroundDrawList()->AddImage(
 			(intptr_t)src_image.texture, ImVec2{pos.x, pos.y},
@@ -867,6 +979,27 @@ auto Sorcery::UI::_draw_menu(Component *component, Game *game) -> void {
 	_menus.emplace_back(std::move(menu));
 }
 
+// Only the lines that are visible are drawn, however long the log gets
+auto Sorcery::UI::_draw_console(Game *game) -> void {
+
+	const auto &log{game->state->get_log()};
+	set_Font(fonts.at(Enums::Layout::Font::DEFAULT));
+	ImGui::SetNextWindowSize(ImVec2{640, 320}, ImGuiCond_FirstUseEver);
+	with_Window("Console", nullptr, ImGuiWindowFlags_NoSavedSettings) {
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(log.size()));
+		while (clipper.Step())
+			for (auto i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+				const auto &line{log[i].line};
+				ImGui::TextUnformatted(line.data(), line.data() + line.size());
+			}
+
+		// Follow new messages unless scrolled back
+		if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+			ImGui::SetScrollHereY(1.0f);
+	}
+}
+
 auto Sorcery::UI::_draw_debug() -> void {
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr,
@@ -885,6 +1018,89 @@ auto Sorcery::UI::_draw_debug() -> void {
 		set_StyleColor(ImGuiCol_Text, ImVec4{1.0f, 0.0f, 0.0f, 1.0f});
 		ImGui::TextUnformatted(_controller->get_characters().c_str());
 	}
+
+#ifndef NDEBUG
+	if (_controller->show_profiler)
+		_draw_profiler();
+#endif
+}
+
+// Frame time percentiles and history, and a timeline of the scopes in the last
+// finished frame (nested scopes are drawn underneath their parents)
+auto Sorcery::UI::_draw_profiler() -> void {
+
+	const auto &profiler{Profiler::get()};
+	ImGui::SetNextWindowSize(ImVec2{720, 320}, ImGuiCond_FirstUseEver);
+	with_Window("Profiler", &_controller->show_profiler,
+				ImGuiWindowFlags_NoSavedSettings) {
+
+		set_Font(fonts.at(Enums::Layout::Font::DEFAULT));
+		const auto [p50, p95, p99]{profiler.get_percentiles()};
+		ImGui::TextUnformatted(
+			std::format("Frame: p50 {:.2f}ms  p95 {:.2f}ms  p99 {:.2f}ms", p50,
+						p95, p99)
+				.c_str());
+
+		if (Allocations::is_tracking()) {
+			const auto allocations{profiler.get_last_allocations()};
+			ImGui::TextUnformatted(
+				std::format("Allocations: {} ({} bytes)", allocations.count,
+							allocations.bytes)
+					.c_str());
+		}
+
+		const auto times{profiler.get_frame_times()};
+		ImGui::PlotLines("##frame_times", times.data(),
+						 static_cast<int>(times.size()), 0, nullptr, 0.0f,
+						 std::max(p99 * 1.25f, 1.0f),
+						 ImVec2{ImGui::GetContentRegionAvail().x, 48});
+
+		const auto [start, end]{profiler.get_last_frame(_profile_samples)};
+		if (end > start) {
+			const auto row_height{ImGui::GetFrameHeight()};
+			const auto origin{ImGui::GetCursorScreenPos()};
+			const auto width{ImGui::GetContentRegionAvail().x};
+			const auto scale{width / static_cast<float>(end - start)};
+			auto draw_list{ImGui::GetWindowDrawList()};
+			auto rows{1u};
+			for (const auto &sample : _profile_samples) {
+
+				// Skip anything left over from another thread's earlier work
+				if (sample.end < start || sample.start > end)
+					continue;
+
+				const auto from{std::max(sample.start, start) - start};
+				const auto to{std::min(sample.end, end) - start};
+				const ImVec2 p_min{origin.x + static_cast<float>(from) * scale,
+								   origin.y + sample.depth * row_height};
+				const ImVec2 p_max{
+					std::max(origin.x + static_cast<float>(to) * scale,
+							 p_min.x + 1.0f),
+					p_min.y + row_height - 1.0f};
+				const auto hue{static_cast<float>(std::hash<std::string_view>{}(
+												   sample.name) %
+											   360) /
+							   360.0f};
+				draw_list->AddRectFilled(p_min, p_max,
+										 ImColor::HSV(hue, 0.5f, 0.7f));
+				if (text_cache.get_size(sample.name).x < p_max.x - p_min.x - 4)
+					draw_list->AddText(ImVec2{p_min.x + 2, p_min.y},
+									   IM_COL32_WHITE, sample.name);
+				if (ImGui::IsMouseHoveringRect(p_min, p_max))
+					ImGui::SetTooltip(
+						"%s: %.3fms, %llu allocations (%llu bytes)",
+						sample.name,
+						static_cast<double>(sample.end - sample.start) / 1e6,
+						static_cast<unsigned long long>(
+							sample.allocations.count),
+						static_cast<unsigned long long>(
+							sample.allocations.bytes));
+
+				rows = std::max(rows, sample.depth + 1);
+			}
+			ImGui::Dummy(ImVec2{width, rows * row_height});
+		}
+	}
 }
 
 // Draw a Paragraph (Wrapped Multiline Text)
@@ -899,11 +1115,10 @@ auto Sorcery::UI::_draw_paragraph(Component *component) -> void {
 			ImVec2{component->x * adj_grid_w, component->y * adj_grid_h}};
 
 		ImGui::SetCursorPos(p_min);
-		with_TextWrapPos(p_min.x + wrap) {
-			set_StyleColor(ImGuiCol_Text, component->colour);
-			ImGui::TextUnformatted(
-				(*_system->strings)[component->string_key].c_str());
-		}
+		set_StyleColor(ImGuiCol_Text, component->colour);
+		const auto &text{text_cache.get_wrapped(
+			(*_system->strings)[component->string_key], wrap)};
+		ImGui::TextUnformatted(text.data(), text.data() + text.size());
 	}
 }
 
@@ -913,19 +1128,20 @@ auto Sorcery::UI::draw_text(const std::string string, const ImColor colour,
 
 	set_Font(fonts.at(font));
 
+	// Only measure the text if it is being centred
+	const auto size{pos.x == -1 || pos.y == -1 ? text_cache.get_size(string)
+											   : ImVec2{}};
 	const auto x{std::invoke([&] {
 		if (pos.x == -1) {
 			const auto viewport{ImGui::GetMainViewport()};
-			const auto width{ImGui::CalcTextSize(string.c_str())};
-			return (viewport->Size.x - width.x) / 2;
+			return (viewport->Size.x - size.x) / 2;
 		} else
 			return static_cast<float>(pos.x);
 	})};
 	const auto y{std::invoke([&] {
 		if (pos.y == -1) {
 			const auto viewport{ImGui::GetMainViewport()};
-			const auto height{ImGui::CalcTextSize(string.c_str())};
-			return (viewport->Size.y - height.y) / 2;
+			return (viewport->Size.y - size.y) / 2;
 		} else
 			return static_cast<float>(pos.y);
 	})};
@@ -946,8 +1162,8 @@ auto Sorcery::UI::_draw_button_click(Component *component, bool &flag,
 	auto x{std::invoke([&] {
 		if (component->x == -1) {
 			const auto viewport{ImGui::GetMainViewport()};
-			const auto width{ImGui::CalcTextSize(
-				CSTR((*_system->strings)[component->string_key]))};
+			const auto width{
+				text_cache.get_size((*_system->strings)[component->string_key])};
 			return (viewport->Size.x - width.x) / 2;
 		} else
 			return static_cast<float>(adj_grid_w * component->x);
@@ -955,8 +1171,8 @@ auto Sorcery::UI::_draw_button_click(Component *component, bool &flag,
 	auto y{std::invoke([&] {
 		if (component->y == -1) {
 			const auto viewport{ImGui::GetMainViewport()};
-			const auto height{ImGui::CalcTextSize(
-				CSTR((*_system->strings)[component->string_key]))};
+			const auto height{
+				text_cache.get_size((*_system->strings)[component->string_key])};
 			return (viewport->Size.y - height.y) / 2;
 		} else
 			return static_cast<float>(adj_grid_h * component->y);
@@ -997,8 +1213,8 @@ auto Sorcery::UI::_draw_button(Component *component,
 		auto x{std::invoke([&] {
 			if (component->x == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(
-					CSTR((*_system->strings)[component->string_key]))};
+				const auto width{text_cache.get_size(
+					(*_system->strings)[component->string_key])};
 				return (viewport->Size.x - width.x) / 2;
 			} else
 				return static_cast<float>(adj_grid_w * component->x);
@@ -1006,8 +1222,8 @@ auto Sorcery::UI::_draw_button(Component *component,
 		auto y{std::invoke([&] {
 			if (component->y == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(
-					CSTR((*_system->strings)[component->string_key]))};
+				const auto height{text_cache.get_size(
+					(*_system->strings)[component->string_key])};
 				return (viewport->Size.y - height.y) / 2;
 			} else
 				return static_cast<float>(adj_grid_h * component->y);
@@ -1041,7 +1257,7 @@ auto Sorcery::UI::_draw_button(Component *component,
 
 auto Sorcery::UI::_draw_character_detailed(Component *component,
 										   [[maybe_unused]] Game *game,
-										   Character *character) -> void {
+										   const Character *character) -> void {
 
 	const auto left_col{component->x + 0};
 	const auto right_col{component->x + 19};
@@ -1214,7 +1430,7 @@ auto Sorcery::UI::_draw_character_detailed(Component *component,
 
 auto Sorcery::UI::_draw_character_mage_spells(Component *component,
 											  [[maybe_unused]] Game *game,
-											  Character *character) -> void {
+											  const Character *character) -> void {
 
 	ImVec2 pos{component->x * adj_grid_w, component->y * adj_grid_h};
 	ImGui::SetCursorPos(pos);
@@ -1239,20 +1455,17 @@ auto Sorcery::UI::_draw_character_mage_spells(Component *component,
 				auto spell_id{
 					magic_enum::enum_cast<Enums::Magic::SpellID>(index)
 						.value()};
-				auto spells{character->spells() |
-							std::views::filter([&](Spell spell) {
-								return (spell.id == spell_id);
-							})};
-				auto spell{spells.begin()};
+				const auto &spell{(*_resources->spells)[spell_id]};
+				const auto known{character->knows_spell(spell_id)};
 
-				if (!(*spell).known)
+				if (!known)
 					ImGui::BeginDisabled();
 
-				if (ImGui::Selectable((*spell).name.c_str(),
+				if (ImGui::Selectable(spell.name.c_str(),
 									  &ms_selected[unenum(spell_id)])) {
 				};
 
-				if (!(*spell).known)
+				if (!known)
 					ImGui::EndDisabled();
 
 			} else {
@@ -1268,7 +1481,7 @@ auto Sorcery::UI::_draw_character_mage_spells(Component *component,
 
 auto Sorcery::UI::_draw_character_priest_spells(Component *component,
 												[[maybe_unused]] Game *game,
-												Character *character) -> void {
+												const Character *character) -> void {
 
 	ImVec2 pos{component->x * adj_grid_w, component->y * adj_grid_h};
 	ImGui::SetCursorPos(pos);
@@ -1294,20 +1507,17 @@ auto Sorcery::UI::_draw_character_priest_spells(Component *component,
 				auto spell_id{
 					magic_enum::enum_cast<Enums::Magic::SpellID>(index)
 						.value()};
-				auto spells{character->spells() |
-							std::views::filter([&](Spell spell) {
-								return (spell.id == spell_id);
-							})};
-				auto spell{spells.begin()};
+				const auto &spell{(*_resources->spells)[spell_id]};
+				const auto known{character->knows_spell(spell_id)};
 
-				if (!(*spell).known)
+				if (!known)
 					ImGui::BeginDisabled();
 
-				if (ImGui::Selectable((*spell).name.c_str(),
+				if (ImGui::Selectable(spell.name.c_str(),
 									  &ms_selected[unenum(spell_id)])) {
 				};
 
-				if (!(*spell).known)
+				if (!known)
 					ImGui::EndDisabled();
 
 			} else {
@@ -1323,7 +1533,7 @@ auto Sorcery::UI::_draw_character_priest_spells(Component *component,
 
 auto Sorcery::UI::_draw_character_detailed_again(Component *component,
 												 [[maybe_unused]] Game *game,
-												 Character *character) -> void {
+												 const Character *character) -> void {
 
 	const auto left_col{component->x + 0};
 	const auto right_col{component->x + 19};
@@ -1468,7 +1678,7 @@ auto Sorcery::UI::_draw_character_detailed_again(Component *component,
 
 auto Sorcery::UI::_draw_character_summary(Component *component,
 										  [[maybe_unused]] Game *game,
-										  Character *character) -> void {
+										  const Character *character) -> void {
 
 	using Enums::Character::Attribute;
 
@@ -1790,10 +2000,14 @@ auto Sorcery::UI::_draw_current_character(Game *game,
 										  [[maybe_unused]] const int mode)
 	-> void {
 
-	auto character{game->characters.at(_controller->get_character("inspect"))};
+	const auto char_id{_controller->get_character("inspect")};
+	auto &character{game->characters.at(char_id)};
 
 	auto title{(*components)["inspect:character_title"]};
-	_draw_text(&title, character.summary_text());
+	_draw_text(&title,
+			   text_cache.get_text(TextCache::make_key("summary_text", char_id),
+								   character.get_revision(),
+								   [&] { return character.summary_text(); }));
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
 		auto prev{(*components)["inspect:character_previous"]};
@@ -1843,19 +2057,20 @@ auto Sorcery::UI::_draw_text(Component *component, const std::string &string)
 		// assume monospace font size!
 		set_Font(fonts.at(component->font));
 
+		const auto size{component->x == -1 || component->y == -1
+							? text_cache.get_size(string)
+							: ImVec2{}};
 		const auto x{std::invoke([&] {
 			if (component->x == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(CSTR(string))};
-				return (viewport->Size.x - width.x) / 2;
+				return (viewport->Size.x - size.x) / 2;
 			} else
 				return static_cast<float>(adj_grid_w * component->x);
 		})};
 		const auto y{std::invoke([&] {
 			if (component->y == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(CSTR(string))};
-				return (viewport->Size.y - height.y) / 2;
+				return (viewport->Size.y - size.y) / 2;
 			} else
 				return static_cast<float>(adj_grid_h * component->y);
 		})};
@@ -1879,21 +2094,21 @@ auto Sorcery::UI::_draw_text(Component *component) -> void {
 		// assume monospace font size!
 		set_Font(fonts.at(component->font));
 
+		const auto &string{(*_system->strings)[component->string_key]};
+		const auto size{component->x == -1 || component->y == -1
+							? text_cache.get_size(string)
+							: ImVec2{}};
 		const auto x{std::invoke([&] {
 			if (component->x == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(
-					CSTR((*_system->strings)[component->string_key]))};
-				return (viewport->Size.x - width.x) / 2;
+				return (viewport->Size.x - size.x) / 2;
 			} else
 				return static_cast<float>(adj_grid_w * component->x);
 		})};
 		const auto y{std::invoke([&] {
 			if (component->y == -1) {
 				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(
-					CSTR((*_system->strings)[component->string_key]))};
-				return (viewport->Size.y - height.y) / 2;
+				return (viewport->Size.y - size.y) / 2;
 			} else
 				return static_cast<float>(adj_grid_h * component->y);
 		})};
@@ -1904,14 +2119,15 @@ auto Sorcery::UI::_draw_text(Component *component) -> void {
 
 		set_StyleColor(ImGuiCol_Text, alpha_col);
 		ImGui::SetCursorPos(ImVec2{x, y});
-		ImGui::TextUnformatted(
-			(*_system->strings)[component->string_key].c_str());
+		ImGui::TextUnformatted(string.c_str());
 	}
 }
 
 auto Sorcery::UI::_draw_components(std::string_view screen, Game *game,
 								   [[maybe_unused]] const int mode) -> void {
 
+	PROFILE_SCOPE("UI::_draw_components");
+
 	_frames.clear();
 	_menus.clear();
 
@@ -1953,7 +2169,7 @@ auto Sorcery::UI::_draw_item_info() -> void {
 	if (idx >= 100)
 		return;
 
-	const auto item{(*_resources->items)[idx + 1]};
+	const auto &item{(*_resources->items)[idx + 1]};
 	auto item_c{(*components)["museum:item_graphic"]};
 	auto item_pos{ImVec2{item_c.x * adj_grid_w, item_c.y * adj_grid_h}};
 	_draw_fg_image_with_idx(ITEMS_TEXTURE, idx, item_pos,
@@ -2120,145 +2336,12 @@ auto Sorcery::UI::_draw_license(Component *component, const std::string &string)
 }
 
 auto Sorcery::UI::load_message(const Enums::Map::Event event)
-	-> std::vector<std::string> {
+	-> std::span<const std::string_view> {
 
-	switch (event) {
-		using enum Enums::Map::Event;
-	case AREA_OF_OUT_BOUNDS:
-		return {"GAME_MESSAGE_AREA_OUT_OF_BOUNDS_1",
-				"GAME_MESSAGE_AREA_OUT_OF_BOUNDS_2"};
-		break;
-	case MAN_TELEPORT_CASTLE:
-		return {"GAME_MESSAGE_MAN_TELEPORT_CASTLE_1",
-				"GAME_MESSAGE_MAN_TELEPORT_CASTLE_2",
-				"GAME_MESSAGE_MAN_TELEPORT_CASTLE_3",
-				"GAME_MESSAGE_MAN_TELEPORT_CASTLE_4",
-				"GAME_MESSAGE_MAN_TELEPORT_CASTLE_5",
-				"GAME_MESSAGE_MAN_TELEPORT_CASTLE_6"};
-		break;
-	case SILVER_KEY:
-		return {"GAME_MESSAGE_SILVER_KEY_1", "GAME_MESSAGE_SILVER_KEY_2",
-				"GAME_MESSAGE_SILVER_KEY_3", "GAME_MESSAGE_SILVER_KEY_4",
-				"GAME_MESSAGE_SILVER_KEY_5", "GAME_MESSAGE_SILVER_KEY_6",
-				"GAME_MESSAGE_SILVER_KEY_7", "GAME_MESSAGE_SILVER_KEY_8"};
-		break;
-	case BRONZE_KEY:
-		return {"GAME_MESSAGE_BRONZE_KEY_1", "GAME_MESSAGE_BRONZE_KEY_2",
-				"GAME_MESSAGE_BRONZE_KEY_3", "GAME_MESSAGE_BRONZE_KEY_4",
-				"GAME_MESSAGE_BRONZE_KEY_5", "GAME_MESSAGE_BRONZE_KEY_6"};
-		break;
-	case MURPHYS_GHOSTS:
-		return {
-			"GAME_MESSAGE_MURPHYS_GHOSTS_1", "GAME_MESSAGE_MURPHYS_GHOSTS_2",
-			"GAME_MESSAGE_MURPHYS_GHOSTS_3", "GAME_MESSAGE_MURPHYS_GHOSTS_4",
-			"GAME_MESSAGE_MURPHYS_GHOSTS_5"};
-		break;
-	case BEAR_STATUE:
-		return {"GAME_MESSAGE_BEAR_STATUE_1", "GAME_MESSAGE_BEAR_STATUE_2",
-				"GAME_MESSAGE_BEAR_STATUE_3"};
-		break;
-	case FROG_STATUE:
-		return {"GAME_MESSAGE_FROG_STATUE_1", "GAME_MESSAGE_FROG_STATUE_2",
-				"GAME_MESSAGE_FROG_STATUE_3", "GAME_MESSAGE_FROG_STATUE_4"};
-		break;
-	case GOLD_KEY:
-		return {"GAME_MESSAGE_GOLD_KEY_1", "GAME_MESSAGE_GOLD_KEY_2",
-				"GAME_MESSAGE_GOLD_KEY_3", "GAME_MESSAGE_GOLD_KEY_4",
-				"GAME_MESSAGE_GOLD_KEY_5", "GAME_MESSAGE_GOLD_KEY_6"};
-		break;
-	case NEED_SILVER_KEY:
+	if (event == Enums::Map::Event::NO_EVENT)
 		return {};
-		break;
-	case NEED_BRONZE_KEY:
-		return {};
-		break;
-	case NEED_BEAR_STATUE:
-		return {};
-		break;
-	case NEED_FROG_STATUE:
-		return {};
-		break;
-	case PLACARD_PIT_1:
-		return {};
-		break;
-	case PLACARD_PIT_2:
-		return {};
-		break;
-	case PLACARD_PIT_3:
-		return {};
-		break;
-	case TURN_AROUND:
-		return {};
-		break;
-	case TURN_LEFT:
-		return {};
-		break;
-	case TURN_RIGHT:
-		return {};
-		break;
-	case NEED_BEAR_STATUE_2:
-		return {};
-		break;
-	case TESTING_GROUNDS:
-		return {};
-		break;
-	case ALARM_BELLS:
-		return {};
-		break;
-	case TREASURE_REPOSITORY:
-		return {};
-		break;
-	case MONSTER_ALLOCATION_CENTRE:
-		return {};
-		break;
-	case LARGE_DESK:
-		return {};
-		break;
-	case TREBOR_VOICE:
-		return {};
-		break;
-	case SERVICE_ELEVATOR:
-		return {};
-		break;
-	case WERDNA_BOAST:
-		return {};
-		break;
-	case TURN_BACK:
-		return {};
-		break;
-	case WERDNA_SIGN:
-		return {};
-		break;
-	case THREE_HUMANOIDS:
-		return {};
-		break;
-	case GETTING_WARM_1:
-		return {};
-		break;
-	case GETTING_WARM_2:
-		return {};
-		break;
-	case GETTING_WARM_3:
-		return {};
-		break;
-	case FIRE_DRAGONS_COMBAT:
-		return {};
-		break;
-	case DEADLY_RING_COMBAT:
-		return {};
-		break;
-	case WERDNA_COMBAT:
-		return {};
-		break;
-	case GUARANTEED_COMBAT:
-		return {};
-		break;
-	case NEED_BLUE_RIBBON:
-		return {};
-		break;
-	default:
-		return {};
-	};
+
+	return get_event_descriptor(event).messages;
 }
 
 auto Sorcery::UI::_draw_options() -> void {
@@ -2569,9 +2652,13 @@ auto Sorcery::UI::_draw_party_panel(Game *game) -> void {
 				for (const auto party{game->state->get_party_characters()};
 					 auto char_id : party) {
 					auto p_y{0 + (position * grid_sz)};
-					auto character{game->characters.at(char_id)};
+					auto &character{game->characters.at(char_id)};
 					auto colour{_get_status_color(&character)};
-					auto summary{character.get_party_panel_text(position)};
+					const auto &summary{text_cache.get_text(
+						TextCache::make_key("party_panel", char_id, position),
+						character.get_revision(), [&] {
+							return character.get_party_panel_text(position);
+						})};
 					set_StyleColor(ImGuiCol_Text, colour);
 					ImGui::SetCursorPos(ImVec2{0, p_y});
 					ImGui::TextUnformatted(summary.c_str());
@@ -2681,7 +2768,7 @@ auto Sorcery::UI::_draw_spell_info() -> void {
 auto Sorcery::UI::_draw_monster_info() -> void {
 	// Custom Rendering
 	const auto idx{_controller->selected["bestiary_selected"]};
-	const auto mon{(*_resources->monsters)[idx]};
+	const auto &mon{(*_resources->monsters)[idx]};
 	const auto k_gfx{mon.get_known_gfx()};
 	const auto u_gfx{mon.get_unknown_gfx()};
 	auto k_mg_c{(*components)["bestiary:known_monster_graphic"]};
@@ -3264,7 +3351,7 @@ auto Sorcery::UI::load_dynamic_menu_items(
 		   [[maybe_unused]] const int flags) -> void {
 		if (!game->characters.empty()) {
 			if (controller->has_character("inspect")) {
-				auto character{
+				const auto &character{
 					game->characters.at(controller->get_character("inspect"))};
 				auto chance{character.abilities().at(
 					Enums::Character::Ability::IDENTIFY_ITEMS)};
@@ -3611,7 +3698,7 @@ auto Sorcery::UI::load_fixed_items(std::string_view component,
 			"{:^{}}", (*_system->strings)["BESTIARY_RETURN"], width));
 
 	} else if (component == "spellbook_menu") {
-		for (const auto spells{_resources->spells->get_all()};
+		for (const auto &spells{_resources->spells->get_all()};
 			 auto &spell : spells) {
 			auto sname{spell.name};
 			auto padded{std::format("{:^{}}", sname, width)};
@@ -0,0 +1,304 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/wireframe.hpp"
+#include "types/image.hpp"
+
+namespace {
+
+constexpr std::string_view VERTEX_SHADER{R"(
+in vec2 a_position;
+in vec2 a_uv;
+in vec3 a_colour;
+uniform vec2 u_offset;
+uniform float u_scale;
+uniform vec4 u_display;
+uniform vec4 u_uv_rect;
+out vec2 v_uv;
+out vec3 v_colour;
+void main() {
+	vec2 ndc = ((u_offset + a_position * u_scale - u_display.xy) /
+		u_display.zw) * 2.0 - 1.0;
+	gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+	v_uv = mix(u_uv_rect.xy, u_uv_rect.zw, a_uv);
+	v_colour = a_colour;
+}
+)"};
+
+// Monochrome draws everything in white, otherwise the quad colour tints
+constexpr std::string_view FRAGMENT_SHADER{R"(
+uniform sampler2D u_texture;
+uniform float u_fade;
+uniform int u_monochrome;
+in vec2 v_uv;
+in vec3 v_colour;
+out vec4 o_colour;
+void main() {
+	vec3 tint = u_monochrome != 0 ? vec3(1.0) : v_colour;
+	o_colour = texture(u_texture, v_uv) * vec4(tint, u_fade);
+}
+)"};
+
+// Every quad of a tile view, in the order they are laid out
+auto get_quads(Sorcery::TileView &tileview) {
+
+	return std::array{&tileview.floor,			 &tileview.ceiling,
+					  &tileview.up,				 &tileview.down,
+					  &tileview.darkness,		 &tileview.side_darkness,
+					  &tileview.back_wall,		 &tileview.back_door,
+					  &tileview.left_side_wall,	 &tileview.left_side_door,
+					  &tileview.right_side_wall, &tileview.right_side_door};
+}
+
+using TileViewQuads = decltype(get_quads(std::declval<Sorcery::TileView &>()));
+
+} // namespace
+
+// GL objects are created on first use, as there may not be a context yet
+Sorcery::Wireframe::Wireframe(const char *glsl_version)
+	: _glsl_version{glsl_version},
+	  _available{std::nullopt},
+	  _dirty{true},
+	  _program{0},
+	  _vao{0},
+	  _vbo{0},
+	  _ebo{0},
+	  _u_offset{-1},
+	  _u_scale{-1},
+	  _u_display{-1},
+	  _u_uv_rect{-1},
+	  _u_fade{-1},
+	  _u_monochrome{-1},
+	  _u_texture{-1},
+	  _pos{0, 0},
+	  _scale{1.0f},
+	  _display{0, 0, 1, 1},
+	  _uv_rect{0, 0, 1, 1},
+	  _texture{0},
+	  _fade{1.0f},
+	  _monochrome{false} {}
+
+Sorcery::Wireframe::~Wireframe() {
+
+	if (_available.value_or(false)) {
+		glDeleteBuffers(1, &_ebo);
+		glDeleteBuffers(1, &_vbo);
+		glDeleteVertexArrays(1, &_vao);
+		glDeleteProgram(_program);
+	}
+}
+
+// Lay out every quad of every tile view in the vertex buffer, and note in each
+// VertexArray which quad it is so it can be referred to when drawing
+auto Sorcery::Wireframe::build(std::map<Coordinate3, TileView> &tileviews,
+							   const ImVec2 source_size) -> void {
+
+	_vertices.clear();
+	_vertices.reserve(tileviews.size() * std::tuple_size_v<TileViewQuads> * 4);
+	auto quad{0};
+	for (auto &[loc, tileview] : tileviews) {
+		for (auto array : get_quads(tileview)) {
+			array->quad = quad++;
+			for (const auto &vertex : array->data)
+				_vertices.push_back(WireframeVertex{
+					vertex.position.x, vertex.position.y,
+					vertex.tex_coord.x / source_size.x,
+					vertex.tex_coord.y / source_size.y, vertex.colour.x,
+					vertex.colour.y, vertex.colour.z});
+		}
+	}
+
+	_dirty = true;
+}
+
+// False if there is no OpenGL 3.0 or the shaders could not be built, in which
+// case the caller should draw the view some other way
+auto Sorcery::Wireframe::is_available() -> bool {
+
+	if (!_available)
+		_available = _init();
+
+	return _available.value();
+}
+
+auto Sorcery::Wireframe::begin(const ImVec2 pos, const float scale) -> void {
+
+	_indices.clear();
+	_pos = pos;
+	_scale = scale;
+}
+
+// Quads are drawn in the order they are added
+auto Sorcery::Wireframe::add(const VertexArray &array) -> void {
+
+	if (array.quad < 0)
+		return;
+
+	const auto first{static_cast<GLushort>(array.quad * 4)};
+	_indices.insert(_indices.end(),
+					{first, static_cast<GLushort>(first + 1),
+					 static_cast<GLushort>(first + 2), first,
+					 static_cast<GLushort>(first + 2),
+					 static_cast<GLushort>(first + 3)});
+}
+
+auto Sorcery::Wireframe::submit(ImDrawList *draw_list, const Image &image,
+								const float fade, const bool monochrome)
+	-> void {
+
+	if (_indices.empty())
+		return;
+
+	const auto viewport{ImGui::GetMainViewport()};
+	_display = ImVec4{viewport->Pos.x, viewport->Pos.y, viewport->Size.x,
+					  viewport->Size.y};
+	_uv_rect = ImVec4{image.uv_min.x, image.uv_min.y, image.uv_max.x,
+					  image.uv_max.y};
+	_texture = image.texture;
+	_fade = fade;
+	_monochrome = monochrome;
+
+	draw_list->AddCallback(&Wireframe::_callback, this);
+	draw_list->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+}
+
+auto Sorcery::Wireframe::_callback([[maybe_unused]] const ImDrawList *draw_list,
+								   const ImDrawCmd *cmd) -> void {
+
+	static_cast<Wireframe *>(cmd->UserCallbackData)->_render();
+}
+
+auto Sorcery::Wireframe::_init() -> bool {
+
+	// Shaders, buffers and vertex arrays all need OpenGL 3.0 through GLEW
+	if (!GLEW_VERSION_3_0)
+		return false;
+
+	const auto vertex_shader{_compile(GL_VERTEX_SHADER, VERTEX_SHADER)};
+	const auto fragment_shader{_compile(GL_FRAGMENT_SHADER, FRAGMENT_SHADER)};
+	if (vertex_shader == 0 || fragment_shader == 0) {
+		glDeleteShader(vertex_shader);
+		glDeleteShader(fragment_shader);
+		return false;
+	}
+
+	_program = glCreateProgram();
+	glAttachShader(_program, vertex_shader);
+	glAttachShader(_program, fragment_shader);
+	glBindAttribLocation(_program, 0, "a_position");
+	glBindAttribLocation(_program, 1, "a_uv");
+	glBindAttribLocation(_program, 2, "a_colour");
+	glLinkProgram(_program);
+	glDeleteShader(vertex_shader);
+	glDeleteShader(fragment_shader);
+
+	GLint linked{GL_FALSE};
+	glGetProgramiv(_program, GL_LINK_STATUS, &linked);
+	if (linked != GL_TRUE) {
+		glDeleteProgram(_program);
+		_program = 0;
+		return false;
+	}
+
+	_u_offset = glGetUniformLocation(_program, "u_offset");
+	_u_scale = glGetUniformLocation(_program, "u_scale");
+	_u_display = glGetUniformLocation(_program, "u_display");
+	_u_uv_rect = glGetUniformLocation(_program, "u_uv_rect");
+	_u_fade = glGetUniformLocation(_program, "u_fade");
+	_u_monochrome = glGetUniformLocation(_program, "u_monochrome");
+	_u_texture = glGetUniformLocation(_program, "u_texture");
+
+	glGenVertexArrays(1, &_vao);
+	glGenBuffers(1, &_vbo);
+	glGenBuffers(1, &_ebo);
+	glBindVertexArray(_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(
+		0, 2, GL_FLOAT, GL_FALSE, sizeof(WireframeVertex),
+		reinterpret_cast<void *>(offsetof(WireframeVertex, x)));
+	glVertexAttribPointer(
+		1, 2, GL_FLOAT, GL_FALSE, sizeof(WireframeVertex),
+		reinterpret_cast<void *>(offsetof(WireframeVertex, u)));
+	glVertexAttribPointer(
+		2, 3, GL_FLOAT, GL_FALSE, sizeof(WireframeVertex),
+		reinterpret_cast<void *>(offsetof(WireframeVertex, r)));
+	glBindVertexArray(0);
+
+	return true;
+}
+
+auto Sorcery::Wireframe::_compile(const GLenum type, std::string_view source)
+	-> GLuint {
+
+	const auto shader{glCreateShader(type)};
+	const std::array<const GLchar *, 2> sources{_glsl_version.c_str(),
+												source.data()};
+	const std::array<GLint, 2> lengths{
+		static_cast<GLint>(_glsl_version.size()),
+		static_cast<GLint>(source.size())};
+	glShaderSource(shader, 2, sources.data(), lengths.data());
+	glCompileShader(shader);
+
+	GLint compiled{GL_FALSE};
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+	if (compiled != GL_TRUE) {
+		glDeleteShader(shader);
+		return 0;
+	}
+
+	return shader;
+}
+
+// Called from within ImGui's renderer, which restores its own state afterwards
+auto Sorcery::Wireframe::_render() -> void {
+
+	glUseProgram(_program);
+	glBindVertexArray(_vao);
+	if (_dirty) {
+		glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+		glBufferData(GL_ARRAY_BUFFER,
+					 _vertices.size() * sizeof(WireframeVertex),
+					 _vertices.data(), GL_STATIC_DRAW);
+		_dirty = false;
+	}
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, _indices.size() * sizeof(GLushort),
+				 _indices.data(), GL_STREAM_DRAW);
+
+	glUniform2f(_u_offset, _pos.x, _pos.y);
+	glUniform1f(_u_scale, _scale);
+	glUniform4f(_u_display, _display.x, _display.y, _display.z, _display.w);
+	glUniform4f(_u_uv_rect, _uv_rect.x, _uv_rect.y, _uv_rect.z, _uv_rect.w);
+	glUniform1f(_u_fade, _fade);
+	glUniform1i(_u_monochrome, _monochrome ? 1 : 0);
+	glUniform1i(_u_texture, 0);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, _texture);
+	glDisable(GL_SCISSOR_TEST);
+
+	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_indices.size()),
+				   GL_UNSIGNED_SHORT, nullptr);
+}
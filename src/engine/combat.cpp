@@ -0,0 +1,255 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "engine/combat.hpp"
+#include "core/resources.hpp"
+#include "types/character.hpp"
+#include "types/monstertype.hpp"
+
+Sorcery::Combat::Combat(Resources *resources, const std::uint64_t seed)
+	: _resources{resources},
+	  _random{seed} {}
+
+// Returns the index of the new group; hit points for the whole group are rolled
+// at once
+auto Sorcery::Combat::add_group(const Enums::Monsters::TypeID type,
+								const unsigned int count) -> unsigned int {
+
+	const auto &monster_type{(*_resources->monsters)[type]};
+	const auto first{static_cast<unsigned int>(_monster_hp.size())};
+	_groups.push_back(CombatGroup{type, first, count,
+								  static_cast<int>(monster_type.get_level()),
+								  monster_type.get_attacks()});
+
+	_roll(monster_type.get_hit_dice(), count, _damage_rolls);
+	for (const auto hp : _damage_rolls) {
+		_monster_hp.push_back(std::max(hp, 1));
+		_monster_ac.push_back(monster_type.get_armour_class());
+		_monster_status.push_back(COMBAT_ALIVE | COMBAT_AWAKE);
+	}
+
+	return static_cast<unsigned int>(_groups.size() - 1);
+}
+
+// Add characters in party order; they fight with the first weapon they have
+// equipped (or bare handed)
+auto Sorcery::Combat::add_character(const Character &character) -> void {
+
+	using enum Enums::Character::Status;
+
+	auto damage{Dice{1, COMBAT_UNARMED_SIDES}};
+	for (const auto &item : character.inventory.items())
+		if (item.get_equipped() &&
+			item.get_category() == Enums::Items::Category::WEAPON) {
+			damage = (*_resources->items)[item.get_type_id()].get_damage_dice();
+			break;
+		}
+
+	const auto status{character.get_status()};
+	const auto alive{status != DEAD && status != ASHES && status != LOST &&
+					 status != STONED};
+	const auto awake{status == OK || status == AFRAID || status == SILENCED};
+	_party_hp.push_back(alive ? character.get_current_hp() : 0);
+	_party_ac.push_back(character.get_cur_ac());
+	_party_to_hit.push_back(character.get_cur_to_hit());
+	_party_swings.push_back(std::max(character.get_cur_num_attacks(), 1));
+	_party_damage.push_back(damage);
+	_party_status.push_back((alive ? COMBAT_ALIVE : 0u) |
+							(alive && awake ? COMBAT_AWAKE : 0u));
+}
+
+// Each party member attacks the group given in targets (or parries if -1),
+// and then every monster still standing attacks the front row
+auto Sorcery::Combat::resolve_round(std::span<const int> targets)
+	-> CombatRound {
+
+	CombatRound round{std::vector<int>(_groups.size(), 0),
+					  std::vector<int>(_groups.size(), 0),
+					  std::vector<int>(_party_hp.size(), 0), 0, 0};
+	_party_attacks(targets, round);
+	_monster_attacks(round);
+
+	return round;
+}
+
+auto Sorcery::Combat::get_groups() const -> std::span<const CombatGroup> {
+
+	return _groups;
+}
+
+auto Sorcery::Combat::get_alive(const unsigned int group) const
+	-> unsigned int {
+
+	const auto &info{_groups.at(group)};
+	const auto first{_monster_status.begin() + info.first};
+
+	return static_cast<unsigned int>(
+		std::count_if(first, first + info.count, [](const auto status) {
+			return (status & COMBAT_ALIVE) != 0;
+		}));
+}
+
+auto Sorcery::Combat::get_monster_hp() const -> std::span<const int> {
+
+	return _monster_hp;
+}
+
+auto Sorcery::Combat::get_party_hp() const -> std::span<const int> {
+
+	return _party_hp;
+}
+
+auto Sorcery::Combat::is_over() const -> bool {
+
+	const auto alive{[](const auto status) {
+		return (status & COMBAT_ALIVE) != 0;
+	}};
+
+	return std::ranges::none_of(_monster_status, alive) ||
+		   std::ranges::none_of(_party_status, alive);
+}
+
+auto Sorcery::Combat::set_asleep(const unsigned int group, const bool value)
+	-> void {
+
+	const auto &info{_groups.at(group)};
+	for (auto monster = info.first; monster < info.first + info.count;
+		 monster++)
+		if ((_monster_status[monster] & COMBAT_ALIVE) != 0)
+			_monster_status[monster] =
+				value ? COMBAT_ALIVE : COMBAT_ALIVE | COMBAT_AWAKE;
+}
+
+// Each roll is 1 to sides
+auto Sorcery::Combat::_roll(const unsigned int count, const unsigned int sides,
+							std::vector<int> &rolls) -> void {
+
+	auto dist{std::uniform_int_distribution<int>(1, static_cast<int>(sides))};
+	rolls.resize(count);
+	for (auto &roll : rolls)
+		roll = dist(_random);
+}
+
+// Each roll is the total of all the dice plus the modifier
+auto Sorcery::Combat::_roll(const Dice &dice, const unsigned int count,
+							std::vector<int> &rolls) -> void {
+
+	rolls.assign(count, dice.mod);
+	if (dice.dice == 0)
+		return;
+
+	auto dist{
+		std::uniform_int_distribution<int>(1, static_cast<int>(dice.dice))};
+	for (auto &roll : rolls)
+		for (auto die = 0u; die < dice.num; die++)
+			roll += dist(_random);
+}
+
+// Every swing a party member makes goes at the first monster still standing
+// in their target group, with to hit and damage rolled for all swings at once
+auto Sorcery::Combat::_party_attacks(std::span<const int> targets,
+									 CombatRound &round) -> void {
+
+	const auto members{std::min(_party_hp.size(), targets.size())};
+	for (auto member = 0u; member < members; member++) {
+
+		const auto target{targets[member]};
+		if (target < 0 || target >= static_cast<int>(_groups.size()) ||
+			(_party_status[member] & COMBAT_AWAKE) == 0)
+			continue;
+
+		const auto &group{_groups[target]};
+		const auto swings{static_cast<unsigned int>(_party_swings[member])};
+		_roll(swings, COMBAT_TO_HIT_DIE, _to_hit_rolls);
+		_roll(_party_damage[member], swings, _damage_rolls);
+
+		auto monster{group.first};
+		const auto last{group.first + group.count};
+		for (auto swing = 0u; swing < swings; swing++) {
+
+			while (monster < last &&
+				   (_monster_status[monster] & COMBAT_ALIVE) == 0)
+				++monster;
+			if (monster == last)
+				break;
+
+			if (_to_hit_rolls[swing] + _party_to_hit[member] +
+					_monster_ac[monster] <
+				COMBAT_TO_HIT_TARGET)
+				continue;
+
+			const auto damage{std::max(_damage_rolls[swing], 1)};
+			++round.party_hits;
+			round.group_damage[target] += damage;
+			_monster_hp[monster] -= damage;
+			if (_monster_hp[monster] <= 0) {
+				_monster_hp[monster] = 0;
+				_monster_status[monster] = 0;
+				++round.group_killed[target];
+			}
+		}
+	}
+}
+
+// Monsters can only reach the front row, and pick a target at random; each of
+// their attacks is rolled for the whole group at once
+auto Sorcery::Combat::_monster_attacks(CombatRound &round) -> void {
+
+	std::array<unsigned int, COMBAT_FRONT_ROW> front{};
+	auto front_count{0u};
+	for (auto member = 0u;
+		 member < _party_hp.size() && front_count < COMBAT_FRONT_ROW; member++)
+		if ((_party_status[member] & COMBAT_ALIVE) != 0)
+			front[front_count++] = member;
+	if (front_count == 0)
+		return;
+
+	for (const auto &group : _groups) {
+		for (const auto &attack : group.attacks) {
+
+			_roll(group.count, COMBAT_TO_HIT_DIE, _to_hit_rolls);
+			_roll(attack, group.count, _damage_rolls);
+			_roll(group.count, front_count, _target_rolls);
+			for (auto i = 0u; i < group.count; i++) {
+
+				const auto monster{group.first + i};
+				const auto member{front[_target_rolls[i] - 1]};
+				if (_monster_status[monster] != (COMBAT_ALIVE | COMBAT_AWAKE) ||
+					(_party_status[member] & COMBAT_ALIVE) == 0)
+					continue;
+
+				if (_to_hit_rolls[i] + group.level + _party_ac[member] <
+					COMBAT_TO_HIT_TARGET)
+					continue;
+
+				const auto damage{std::max(_damage_rolls[i], 1)};
+				++round.monster_hits;
+				round.party_damage[member] += damage;
+				_party_hp[member] -= damage;
+				if (_party_hp[member] <= 0) {
+					_party_hp[member] = 0;
+					_party_status[member] = 0;
+				}
+			}
+		}
+	}
+}
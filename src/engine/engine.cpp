@@ -24,6 +24,8 @@
 #include "common/macro.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "engine/define.hpp"
@@ -41,7 +43,8 @@ Sorcery::Engine::Engine(System *system, Display *display, UI *ui,
 	: _system{system},
 	  _display{display},
 	  _ui{ui},
-	  _controller{controller} {
+	  _controller{controller},
+	  _ouch_tick{0} {
 
 	_options = std::make_unique<Options>(_system, _display, _ui, _controller);
 	_reorder = std::make_unique<Reorder>(_system, _display, _ui, _controller);
@@ -50,7 +53,10 @@ Sorcery::Engine::Engine(System *system, Display *display, UI *ui,
 	_initialise();
 };
 
-Sorcery::Engine::~Engine() {}
+Sorcery::Engine::~Engine() {
+
+	_system->scheduler->remove(_ouch_tick);
+}
 
 auto Sorcery::Engine::_initialise() -> bool {
 
@@ -74,7 +80,9 @@ auto Sorcery::Engine::start(Game *game, const int mode) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (Replay::get().poll(&event)) {
+
+			PROFILE_SCOPE("events");
 
 			// Check for Quit Events
 			ImGui_ImplSDL2_ProcessEvent(&event);
@@ -186,14 +194,9 @@ auto Sorcery::Engine::start(Game *game, const int mode) -> int {
 					!_ui->modal_camp->show) {
 
 					// Handle quitting expedition
-					auto party{_game->state->get_party_characters()};
-					for (auto &[id, character] : _game->characters) {
-						if (std::find(party.begin(), party.end(), id) !=
-							party.end()) {
-							character.set_location(
-								Enums::Character::Location::MAZE);
-						}
-					}
+					for (const auto id : _game->state->get_party_characters())
+						_game->set_character_location(
+							id, Enums::Character::Location::MAZE);
 					_controller->busy = true;
 					_game->save_game();
 					_controller->busy = false;
@@ -211,7 +214,11 @@ auto Sorcery::Engine::start(Game *game, const int mode) -> int {
 	return LEAVE_MAZE;
 }
 
-auto Sorcery::Engine::stop() -> void {}
+auto Sorcery::Engine::stop() -> void {
+
+	_system->scheduler->remove(_ouch_tick);
+	_ouch_tick = 0;
+}
 
 auto Sorcery::Engine::_tile_explored(const Coordinate loc) const -> bool {
 
@@ -228,6 +235,7 @@ auto Sorcery::Engine::_go_to_location(const int depth, const Coordinate loc,
 
 	Level level{_game->levels->get(depth).value()};
 	_game->state->set_current_level(&level);
+	_ui->prepare_view(level);
 	_game->state->set_player_pos(loc);
 	_game->state->set_player_prev_depth(_game->state->get_depth());
 	_game->state->set_depth(depth);
@@ -377,14 +385,18 @@ auto Sorcery::Engine::_move_forward() -> bool {
 auto Sorcery::Engine::_callback_stop_popup_ouch(Uint32, void *param) -> Uint32 {
 
 	((Engine *)param)->_ui->popup_ouch->show = false;
+	((Engine *)param)->_ouch_tick = 0;
 
 	return 0;
 }
 
 auto Sorcery::Engine::_start_popup_ouch() -> void {
 
+	// Bumping into another wall restarts the time the popup is shown for
 	_ui->popup_ouch->show = true;
-	SDL_AddTimer(2000, &Engine::_callback_stop_popup_ouch, this);
+	_system->scheduler->remove(_ouch_tick);
+	_ouch_tick =
+		_system->scheduler->add(2000, &Engine::_callback_stop_popup_ouch, this);
 }
 
 auto Sorcery::Engine::_go_back_to_town() -> int {
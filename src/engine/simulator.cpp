@@ -0,0 +1,244 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "engine/simulator.hpp"
+#include "core/resources.hpp"
+#include "core/system.hpp"
+#include "core/threadpool.hpp"
+#include "core/trace.hpp"
+#include "engine/combat.hpp"
+#include "resources/itemstore.hpp"
+#include "resources/monsterstore.hpp"
+#include "types/monstertype.hpp"
+
+namespace {
+
+// SplitMix64, so that neighbouring encounter indexes get unrelated seeds
+auto mix(std::uint64_t value) -> std::uint64_t {
+
+	value += 0x9e3779b97f4a7c15ull;
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+
+	return value ^ (value >> 31);
+}
+
+// Dice::roll uses a shared RNG, which isn't safe to use from the workers
+auto roll(const Sorcery::Dice &dice, std::mt19937_64 &random) -> int {
+
+	auto total{dice.mod};
+	if (dice.dice == 0)
+		return total;
+
+	auto dist{
+		std::uniform_int_distribution<int>(1, static_cast<int>(dice.dice))};
+	for (auto die = 0u; die < dice.num; die++)
+		total += dist(random);
+
+	return total;
+}
+
+} // namespace
+
+Sorcery::Simulator::Simulator(System *system, Resources *resources,
+							  const SimulationConfig &config)
+	: _system{system},
+	  _resources{resources},
+	  _config{config},
+	  _depth{static_cast<unsigned int>(std::max(config.depth, 1))} {
+
+	_create_parties();
+}
+
+auto Sorcery::Simulator::get_monster_types() const
+	-> std::span<const Enums::Monsters::TypeID> {
+
+	return _resources->encounters->get_types(_depth);
+}
+
+// Results are empty if there are no monsters at this depth
+auto Sorcery::Simulator::run() -> SimulationResult {
+
+	ThreadPool pool{_config.threads};
+	std::vector<SimulationTotals> totals(pool.size(), SimulationTotals{});
+	const auto start{std::chrono::steady_clock::now()};
+	if (!get_monster_types().empty() && !_parties.empty()) {
+		TRACE_SCOPE("simulate");
+		pool.parallel_for(
+			_config.encounters, SIM_CHUNK_SIZE,
+			[&](const std::size_t index, const unsigned int worker) {
+				_encounter(index, totals[worker]);
+			});
+	}
+	const auto elapsed{std::chrono::steady_clock::now() - start};
+
+	SimulationResult result{
+		SimulationTotals{}, pool.size(),
+		std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)};
+	for (const auto &worker : totals) {
+		result.totals.encounters += worker.encounters;
+		result.totals.wins += worker.wins;
+		result.totals.rounds += worker.rounds;
+		result.totals.hp_lost += worker.hp_lost;
+		result.totals.xp += worker.xp;
+		result.totals.gold += worker.gold;
+	}
+
+	return result;
+}
+
+// Each party is the same line up as the debug party, equipped the same way
+// and levelled up to the level asked for; this uses the system RNG, so happens
+// up front on this thread
+auto Sorcery::Simulator::_create_parties() -> void {
+
+	using enum Enums::Character::Align;
+	using enum Enums::Character::Class;
+	using enum Enums::Items::TypeID;
+
+	_system->random->seed(_config.seed);
+	const std::array classes{FIGHTER, FIGHTER, THIEF, PRIEST, BISHOP, MAGE};
+	auto &items{*_resources->items};
+	for (auto party = 0u; party < _config.parties; party++) {
+
+		const auto align{party % 2 == 0 ? GOOD : EVIL};
+		std::vector<Character> characters{};
+		for (const auto character_class : classes) {
+			Character character{_system, _resources};
+			character.create_class_alignment(
+				character_class,
+				character_class == FIGHTER || character_class == THIEF ||
+						character_class == MAGE
+					? NEUTRAL
+					: align);
+			character.finalise();
+			character.set_stage(Enums::Character::Stage::COMPLETED);
+			character.inventory.clear();
+			switch (character_class) { // NOLINT(clang-diagnostic-switch)
+			case FIGHTER:
+				character.inventory.add_type(items[LEATHER_ARMOR], true);
+				character.inventory.add_type(items[LONG_SWORD], true);
+				break;
+			case MAGE:
+				character.inventory.add_type(items[ROBES], true);
+				character.inventory.add_type(items[DAGGER], true);
+				break;
+			case PRIEST:
+			case BISHOP:
+				character.inventory.add_type(items[ROBES], true);
+				character.inventory.add_type(items[STAFF], true);
+				break;
+			case THIEF:
+				character.inventory.add_type(items[LEATHER_ARMOR], true);
+				character.inventory.add_type(items[SHORT_SWORD], true);
+				break;
+			default:
+				break;
+			}
+
+			for (auto level = 1u; level < _config.level; level++)
+				character.level_up();
+			character.set_current_hp(character.get_max_hp());
+			characters.push_back(character);
+		}
+		_parties.push_back(characters);
+	}
+}
+
+// The front row (the first few still standing) fights the first group that
+// still has anyone standing until one side is wiped out (or we give up); the
+// first monster group comes from the encounter table, and the rest from each
+// group's chance of bringing a partner
+auto Sorcery::Simulator::_encounter(const std::uint64_t index,
+									SimulationTotals &totals) const -> void {
+
+	std::mt19937_64 random{mix(_config.seed ^ mix(index))};
+	const auto &monsters{*_resources->monsters};
+	const auto type_count{monsters.get_all_types().size()};
+
+	Combat combat{_resources, random()};
+	for (const auto &character : _parties[index % _parties.size()])
+		combat.add_character(character);
+
+	auto d100{std::uniform_int_distribution<unsigned int>(1, 100)};
+	auto type{_resources->encounters->draw(_depth, random).value()};
+	for (auto group = 0u; group < SIM_MAX_GROUPS; group++) {
+		const auto &monster_type{monsters[type]};
+		const auto count{
+			std::max(roll(monster_type.get_group_size(), random), 1)};
+		combat.add_group(type, static_cast<unsigned int>(count));
+
+		const auto [partner, chance]{monster_type.get_partners()};
+		if (partner >= type_count || d100(random) > chance)
+			break;
+		type = static_cast<Enums::Monsters::TypeID>(partner);
+	}
+
+	const auto start_hp{std::vector<int>(combat.get_party_hp().begin(),
+										 combat.get_party_hp().end())};
+	std::vector<int> targets(start_hp.size(), -1);
+	auto rounds{0u};
+	while (!combat.is_over() && rounds < SIM_MAX_ROUNDS) {
+		auto target{-1};
+		for (auto group = 0u; group < combat.get_groups().size(); group++)
+			if (combat.get_alive(group) > 0) {
+				target = static_cast<int>(group);
+				break;
+			}
+		const auto party_hp{combat.get_party_hp()};
+		auto front{0u};
+		for (auto member = 0u; member < targets.size(); member++) {
+			const auto fighting{party_hp[member] > 0 &&
+								front < COMBAT_FRONT_ROW};
+			targets[member] = fighting ? target : -1;
+			if (fighting)
+				++front;
+		}
+		combat.resolve_round(targets);
+		++rounds;
+	}
+
+	// Gold is only found if the party wins
+	const auto groups{combat.get_groups()};
+	const auto won{std::ranges::all_of(
+		std::views::iota(0u, static_cast<unsigned int>(groups.size())),
+		[&](const auto group) { return combat.get_alive(group) == 0; })};
+	for (auto group = 0u; group < groups.size(); group++) {
+		const auto &monster_type{monsters[groups[group].type]};
+		const auto killed{groups[group].count - combat.get_alive(group)};
+		totals.xp += static_cast<std::uint64_t>(killed) * monster_type.get_xp();
+		if (won)
+			totals.gold += static_cast<std::uint64_t>(roll(
+				Dice{killed * monster_type.get_level(), SIM_GOLD_SIDES},
+				random));
+	}
+
+	const auto end_hp{combat.get_party_hp()};
+	for (auto member = 0u; member < start_hp.size(); member++)
+		totals.hp_lost +=
+			static_cast<std::uint64_t>(start_hp[member] - end_hp[member]);
+
+	++totals.encounters;
+	totals.rounds += rounds;
+	if (won)
+		++totals.wins;
+}
@@ -24,6 +24,8 @@
 #include "common/macro.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "gui/define.hpp"
@@ -61,7 +63,9 @@ auto Sorcery::Compendium::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (Replay::get().poll(&event)) {
+
+			PROFILE_SCOPE("events");
 
 			// Check for Quit or Back Events
 			ImGui_ImplSDL2_ProcessEvent(&event);
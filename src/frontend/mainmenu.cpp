@@ -23,6 +23,8 @@
 #include "frontend/mainmenu.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "frontend/compendium.hpp"
@@ -65,7 +67,9 @@ auto Sorcery::MainMenu::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (Replay::get().poll(&event)) {
+
+			PROFILE_SCOPE("events");
 
 			// Check for Quit Events
 			ImGui_ImplSDL2_ProcessEvent(&event);
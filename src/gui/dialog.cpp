@@ -55,8 +55,7 @@ auto Sorcery::Dialog::display(bool &is_yes) -> void {
 	const auto grid_sz{_ui->grid_sz};
 	const auto rounding{_ui->frame_rd};
 	const auto width{
-		ImGui::CalcTextSize((*_system->strings)[_component.string_key].c_str())
-			.x +
+		_ui->text_cache.get_size((*_system->strings)[_component.string_key]).x +
 		(grid_sz * 4)};
 	const auto height{_component.h * grid_sz};
 
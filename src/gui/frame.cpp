@@ -114,7 +114,7 @@ auto Sorcery::Frame::_draw(const bool foreground) -> void {
 
 			const auto title_txt{(*_system->strings)[_title.value()]};
 			const auto title_sz{
-				Size{ImGui::CalcTextSize(title_txt.c_str()).x + (font_sz * 2),
+				Size{_ui->text_cache.get_size(title_txt).x + (font_sz * 2),
 					 grid_sz * 3}};
 			const auto title_pos{
 				ImVec2{(x + ((grid_sz * _size.w) / 2)) - (title_sz.w / 2),
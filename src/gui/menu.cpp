@@ -23,6 +23,7 @@
 #include "gui/menu.hpp"
 #include "common/macro.hpp"
 #include "core/controller.hpp"
+#include "core/profiler.hpp"
 #include "core/resources.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
@@ -63,6 +64,8 @@ Sorcery::Menu::Menu(System *system, Resources *resources, UI *ui,
 // Handle special menu items
 auto Sorcery::Menu::regenerate() -> void {
 
+	PROFILE_SCOPE("Menu::regenerate");
+
 	_load_dynamic_items();
 	_load_fixed_items();
 }
@@ -283,7 +286,7 @@ auto Sorcery::Menu::_load_fixed_items() -> void {
 
 	} else if (_component->name == "spellbook_menu") {
 
-		for (const auto spells{_resources->spells->get_all()};
+		for (const auto &spells{_resources->spells->get_all()};
 			 auto &spell : spells) {
 			auto sname{spell.name};
 			auto padded{std::format("{:^{}}", sname, _width)};
@@ -36,7 +36,7 @@ Sorcery::Message::Message(System *system, UI *ui, Component &component)
 	_name = _component.name;
 }
 
-auto Sorcery::Message::set(std::vector<std::string> strings,
+auto Sorcery::Message::set(std::span<const std::string_view> strings,
 						   const Enums::Map::Event event_id) -> void {
 
 	_strings = strings;
@@ -106,16 +106,13 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 						ImVec4{1.0f, 1.0f, 1.0f, _system->animation->fade},
 						rounding);
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-security"
 		auto y_pos{grid_sz * 2};
 		for (const auto &string : _strings) {
 			ImGui::SetCursorPos(ImVec2{grid_sz * 2, y_pos});
-			auto str{_system->strings->get(string)};
-			ImGui::Text(str.c_str());
+			const auto str{_system->strings->get(string)};
+			ImGui::TextUnformatted(str.data(), str.data() + str.size());
 			y_pos += grid_sz;
 		}
-#pragma GCC diagnostic pop
 
 		ImVec2 btn_size{ImGui::GetFontSize() * 8.0f, 0.0f};
 		const auto centre{(width / 2)};
@@ -55,7 +55,7 @@ auto Sorcery::Popup::display() -> void {
 	const auto rounding{_ui->frame_rd};
 
 	set_Font(_ui->fonts.at(_component.font));
-	const auto width{ImGui::CalcTextSize(text.c_str()).x + (grid_sz * 4)};
+	const auto width{_ui->text_cache.get_size(text).x + (grid_sz * 4)};
 	const auto height{_component.h * grid_sz};
 
 	ImVec2 centre{ImGui::GetMainViewport()->GetCenter()};
@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "gui/textcache.hpp"
+
+namespace {
+
+auto combine(const std::size_t key, const std::size_t value) -> std::size_t {
+
+	return key ^ (value + 0x9e3779b9 + (key << 6) + (key >> 2));
+}
+
+// Keep a copy of the text for the cache
+auto own(const Sorcery::TextLayoutView &key) -> Sorcery::TextLayoutKey {
+
+	return Sorcery::TextLayoutKey{key.font, key.size, key.width,
+								  std::string{key.text}};
+}
+
+} // namespace
+
+auto Sorcery::TextLayoutHash::operator()(const TextLayoutView &key) const
+	-> std::size_t {
+
+	auto hash{std::hash<std::string_view>{}(key.text)};
+	hash = combine(hash, std::hash<const void *>{}(key.font));
+	hash = combine(hash, std::hash<float>{}(key.size));
+
+	return combine(hash, std::hash<float>{}(key.width));
+}
+
+auto Sorcery::TextLayoutHash::operator()(const TextLayoutKey &key) const
+	-> std::size_t {
+
+	return (*this)(TextLayoutView{key.font, key.size, key.width, key.text});
+}
+
+auto Sorcery::TextKeyHash::operator()(const TextKey &key) const
+	-> std::size_t {
+
+	auto hash{std::hash<std::string_view>{}(key.name)};
+	hash = combine(hash, std::hash<int>{}(key.id));
+
+	return combine(hash, std::hash<int>{}(key.index));
+}
+
+Sorcery::TextCache::TextCache() {
+
+	_sizes.clear();
+	_wrapped.clear();
+	_texts.clear();
+}
+
+// Equivalent to ImGui::CalcTextSize in the current font
+auto Sorcery::TextCache::get_size(std::string_view text) -> ImVec2 {
+
+	if (_sizes.size() > TEXT_CACHE_SIZE)
+		_sizes.clear();
+
+	const auto key{_get_key(text)};
+	if (auto it{_sizes.find(key)}; it != _sizes.end())
+		return it->second;
+
+	const auto size{
+		ImGui::CalcTextSize(text.data(), text.data() + text.size())};
+	_sizes.emplace(own(key), size);
+
+	return size;
+}
+
+// Break text into lines no wider than width (as ImGui's own wrapping would) so
+// that it can be drawn without being rewrapped every frame
+auto Sorcery::TextCache::get_wrapped(std::string_view text, const float width)
+	-> const std::string & {
+
+	if (_wrapped.size() > TEXT_CACHE_SIZE)
+		_wrapped.clear();
+
+	const auto key{_get_key(text, width)};
+	if (auto it{_wrapped.find(key)}; it != _wrapped.end())
+		return it->second;
+
+	auto font{ImGui::GetFont()};
+	const auto scale{ImGui::GetFontSize() / font->FontSize};
+	std::string wrapped{};
+	wrapped.reserve(text.size() + text.size() / 16);
+
+	auto s{text.data()};
+	const auto end{text.data() + text.size()};
+	while (s < end) {
+		if (*s == '\n') {
+			wrapped.push_back(*s++);
+			continue;
+		}
+
+		auto eol{font->CalcWordWrapPositionA(scale, s, end, width)};
+		if (eol == s)
+			++eol;
+		wrapped.append(s, eol);
+		s = eol;
+
+		// Blanks at a wrap point are dropped
+		if (s < end && *s != '\n') {
+			wrapped.push_back('\n');
+			while (s < end && (*s == ' ' || *s == '\t'))
+				++s;
+		}
+	}
+
+	return _wrapped.emplace(own(key), std::move(wrapped)).first->second;
+}
+
+// Layout depends on the fonts and window size, so flush it when either changes
+auto Sorcery::TextCache::invalidate() -> void {
+
+	_sizes.clear();
+	_wrapped.clear();
+}
+
+auto Sorcery::TextCache::clear() -> void {
+
+	invalidate();
+	_texts.clear();
+}
+
+auto Sorcery::TextCache::make_key(std::string_view name, const int id,
+								  const int index) -> TextKey {
+
+	return TextKey{std::string{name}, id, index};
+}
+
+// Only valid for as long as the text is
+auto Sorcery::TextCache::_get_key(std::string_view text,
+								  const float width) const -> TextLayoutView {
+
+	return TextLayoutView{ImGui::GetFont(), ImGui::GetFontSize(), width, text};
+}
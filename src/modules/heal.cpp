@@ -24,6 +24,8 @@
 #include "common/macro.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "gui/define.hpp"
@@ -66,7 +68,13 @@ auto Sorcery::Heal::start(Game *game) -> int {
 	_controller->move_screen("show_pay", "show_heal");
 	_controller->unset_flag("heal_finished");
 
-	_heal_tick = SDL_AddTimer(2000, &Heal::_callback_heal_tick, this);
+	// When fast-forwarding, skip straight to the result
+	_heal_tick = 0;
+	if (_system->config->get("Gameplay", FAST_FORWARD_KEY) == OPT_ON)
+		_stage = 0;
+	else
+		_heal_tick =
+			_system->scheduler->add(2000, &Heal::_callback_heal_tick, this);
 
 	_character = &game->characters.at(_controller->get_character("help"));
 
@@ -75,7 +83,9 @@ auto Sorcery::Heal::start(Game *game) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (Replay::get().poll(&event)) {
+
+			PROFILE_SCOPE("events");
 
 			// Check for Quit Events
 			ImGui_ImplSDL2_ProcessEvent(&event);
@@ -198,7 +208,7 @@ auto Sorcery::Heal::_try_heal(Game *game, int heal_char_id, int pay_char_id)
 
 auto Sorcery::Heal::stop() -> int {
 
-	SDL_RemoveTimer(_heal_tick);
+	_system->scheduler->remove(_heal_tick);
 
 	_controller->move_screen("show_heal", "show_title");
 
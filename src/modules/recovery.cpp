@@ -24,6 +24,8 @@
 #include "common/macro.hpp"
 #include "core/controller.hpp"
 #include "core/display.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "gui/define.hpp"
@@ -62,54 +64,19 @@ auto Sorcery::Recovery::_callback_napping(Uint32, void *param) -> Uint32 {
 auto Sorcery::Recovery::_callback_recuperating(Uint32, void *param) -> Uint32 {
 
 	auto character{static_cast<Character *>(param)};
+	for (const auto &[mode, weekly_cost, hp_per_week] : RECOVERY_RATES) {
+		if (character->mode != mode)
+			continue;
 
-	auto can_continue = [](Character *character, int weekly_cost,
-						   int hp_per_week) -> bool {
-		auto current_hp{character->get_current_hp()};
-		const auto max_hp{character->get_max_hp()};
-		int current_gold{character->get_gold()};
-		if ((current_hp < max_hp) && (current_gold >= weekly_cost)) {
-			character->set_current_hp(current_hp + hp_per_week);
-			character->set_gold(current_gold - weekly_cost);
-			if (current_hp > max_hp)
-				character->set_current_hp(max_hp);
-			return true;
-		} else
-			return false;
-	};
-
-	switch (character->mode) {
-	case RECOVERY_MODE_COST_10:
-		if (!can_continue(character, 10, 1)) {
+		if (character->recuperate(weekly_cost, hp_per_week, 1) == 0) {
 			character->mode = -1;
 			return 0;
 		}
-		break;
-	case RECOVERY_MODE_COST_50:
-		if (!can_continue(character, 50, 3)) {
-			character->mode = -1;
-			return 0;
-		}
-		break;
-	case RECOVERY_MODE_COST_200:
-		if (!can_continue(character, 200, 5)) {
-			character->mode = -1;
-			return 0;
-		}
-		break;
-	case RECOVERY_MODE_COST_500:
-		if (!can_continue(character, 500, 10)) {
-			character->mode = -1;
-			return 0;
-		}
-		break;
-	default:
-		return 0;
+
+		return 1000;
 	}
 
-	const auto current_age{character->get_age()};
-	character->set_age(current_age + 1);
-	return 1000;
+	return 0;
 }
 
 auto Sorcery::Recovery::start(Game *game, const int mode) -> int {
@@ -120,18 +87,36 @@ auto Sorcery::Recovery::start(Game *game, const int mode) -> int {
 
 	_character = &game->characters.at(_controller->get_character("stay"));
 	_character->mode = mode;
-	if (mode & RECOVERY_MODE_FREE)
-		_rest_tick = SDL_AddTimer(1000, &Recovery::_callback_napping, this);
-	else
-		_rest_tick =
-			SDL_AddTimer(1000, &Recovery::_callback_recuperating, _character);
+	_rest_tick = 0;
+
+	// When fast-forwarding, work out the whole stay at once instead of a week
+	// per second
+	const auto fast_forward{
+		_system->config->get("Gameplay", FAST_FORWARD_KEY) == OPT_ON};
+	if (mode & RECOVERY_MODE_FREE) {
+		if (fast_forward)
+			_controller->set_flag("napping_finished");
+		else
+			_rest_tick = _system->scheduler->add(
+				1000, &Recovery::_callback_napping, this);
+	} else if (fast_forward) {
+		for (const auto &[rate_mode, weekly_cost, hp_per_week] : RECOVERY_RATES)
+			if (mode == rate_mode)
+				_character->recuperate(weekly_cost, hp_per_week,
+									   std::numeric_limits<unsigned int>::max());
+		_character->mode = -1;
+	} else
+		_rest_tick = _system->scheduler->add(
+			1000, &Recovery::_callback_recuperating, _character);
 
 	// Main loop
 	auto done{false};
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (Replay::get().poll(&event)) {
+
+			PROFILE_SCOPE("events");
 
 			// Check for Quit Events
 			ImGui_ImplSDL2_ProcessEvent(&event);
@@ -163,7 +148,7 @@ auto Sorcery::Recovery::start(Game *game, const int mode) -> int {
 
 auto Sorcery::Recovery::stop() -> int {
 
-	SDL_RemoveTimer(_rest_tick);
+	_system->scheduler->remove(_rest_tick);
 
 	_controller->move_screen("show_recovery", "show_stay");
 
@@ -22,7 +22,9 @@
 
 #include "resources/componentstore.hpp"
 #include "common/macro.hpp"
+#include "core/profiler.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 #include "types/component.hpp"
 
 // Standard Constructor
@@ -42,6 +44,8 @@ Sorcery::ComponentStore::ComponentStore(const std::filesystem::path filename) {
 auto Sorcery::ComponentStore::get(std::string_view combined_key)
 	-> Component & {
 
+	PROFILE_SCOPE("ComponentStore::get");
+
 	// swap into _load instead and check if refresh needed is called unnecessary
 	try {
 
@@ -88,6 +92,8 @@ auto Sorcery::ComponentStore::operator[](std::string_view combined_key)
 auto Sorcery::ComponentStore::operator()(std::string_view screen)
 	-> std::optional<std::vector<Component>> {
 
+	PROFILE_SCOPE("ComponentStore::operator()");
+
 	// First check if we need to reload if anything has changed!
 	if (need_refresh())
 		load(_file);
@@ -145,9 +151,23 @@ auto Sorcery::ComponentStore::get_custom(std::string_view screen)
 	return std::nullopt;
 }
 
+// All the string keys referred to, so they can be checked when loaded
+auto Sorcery::ComponentStore::get_string_keys() const
+	-> std::vector<std::string> {
+
+	std::vector<std::string> keys;
+	keys.reserve(_components.size());
+	for (const auto &[unique_key, component] : _components)
+		keys.emplace_back(component.string_key);
+
+	return keys;
+}
+
 auto Sorcery::ComponentStore::load(const std::filesystem::path filename)
 	-> bool {
 
+	TRACE_SCOPE("ComponentStore::load");
+
 	_components.clear();
 
 	// Attempt to load Layout File
@@ -0,0 +1,192 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "resources/encountertable.hpp"
+#include "core/random.hpp"
+#include "core/system.hpp"
+#include "resources/monsterstore.hpp"
+
+// There is a depth for every monster level, so the deepest monsters can still
+// be met; a monster's weight is how many levels it is short of the spread
+Sorcery::EncounterTable::EncounterTable(System *system,
+										const MonsterStore &monsters)
+	: _system{system} {
+
+	const auto types{monsters.get_all_types()};
+	auto depths{0u};
+	for (const auto &monster_type : types)
+		depths = std::max(depths, monster_type.get_level());
+	_depths.resize(depths);
+	_categories.resize(depths);
+
+	std::vector<double> weights{};
+	std::vector<double> category_weights{};
+	for (auto depth = 1u; depth <= depths; depth++) {
+		auto &table{_depths[depth - 1]};
+		weights.clear();
+		for (const auto &monster_type : types)
+			if (const auto level{monster_type.get_level()};
+				level >= depth && level <= depth + ENCOUNTER_LEVEL_SPREAD) {
+				table.types.push_back(monster_type.get_type_id());
+				weights.push_back(
+					static_cast<double>(ENCOUNTER_LEVEL_SPREAD + 1 -
+										(level - depth)));
+			}
+		table.alias = AliasTable{weights};
+
+		for (auto &[category, category_table] : _categories[depth - 1]) {
+			category_weights.clear();
+			for (auto i = 0u; i < table.types.size(); i++)
+				if (monsters[table.types[i]].get_category() == category) {
+					category_table.types.push_back(table.types[i]);
+					category_weights.push_back(weights[i]);
+				}
+			category_table.alias = AliasTable{category_weights};
+		}
+	}
+}
+
+auto Sorcery::EncounterTable::get_depths() const -> unsigned int {
+
+	return static_cast<unsigned int>(_depths.size());
+}
+
+// Empty if there is no such depth
+auto Sorcery::EncounterTable::get_types(const unsigned int depth) const
+	-> std::span<const Enums::Monsters::TypeID> {
+
+	if (const auto *table{_get_depth(depth)}; table != nullptr)
+		return table->types;
+
+	return {};
+}
+
+auto Sorcery::EncounterTable::draw(const unsigned int depth) const
+	-> std::optional<Enums::Monsters::TypeID> {
+
+	return _draw(_get_depth(depth), _system->random->get_bits());
+}
+
+auto Sorcery::EncounterTable::draw(const unsigned int depth,
+								   std::mt19937_64 &random) const
+	-> std::optional<Enums::Monsters::TypeID> {
+
+	return _draw(_get_depth(depth), random());
+}
+
+auto Sorcery::EncounterTable::draw(
+	const unsigned int depth, const unsigned int count,
+	std::vector<Enums::Monsters::TypeID> &types) const -> bool {
+
+	return _draw(_get_depth(depth), count, types,
+				 [this] { return _system->random->get_bits(); });
+}
+
+auto Sorcery::EncounterTable::draw(const unsigned int depth,
+								   const unsigned int count,
+								   std::vector<Enums::Monsters::TypeID> &types,
+								   std::mt19937_64 &random) const -> bool {
+
+	return _draw(_get_depth(depth), count, types, random);
+}
+
+auto Sorcery::EncounterTable::draw(
+	const unsigned int depth, const Enums::Monsters::Category category) const
+	-> std::optional<Enums::Monsters::TypeID> {
+
+	return _draw(_get_category(depth, category), _system->random->get_bits());
+}
+
+auto Sorcery::EncounterTable::draw(const unsigned int depth,
+								   const Enums::Monsters::Category category,
+								   std::mt19937_64 &random) const
+	-> std::optional<Enums::Monsters::TypeID> {
+
+	return _draw(_get_category(depth, category), random());
+}
+
+auto Sorcery::EncounterTable::draw(
+	const unsigned int depth, const Enums::Monsters::Category category,
+	const unsigned int count, std::vector<Enums::Monsters::TypeID> &types) const
+	-> bool {
+
+	return _draw(_get_category(depth, category), count, types,
+				 [this] { return _system->random->get_bits(); });
+}
+
+auto Sorcery::EncounterTable::draw(const unsigned int depth,
+								   const Enums::Monsters::Category category,
+								   const unsigned int count,
+								   std::vector<Enums::Monsters::TypeID> &types,
+								   std::mt19937_64 &random) const -> bool {
+
+	return _draw(_get_category(depth, category), count, types, random);
+}
+
+auto Sorcery::EncounterTable::_get_depth(const unsigned int depth) const
+	-> const Table * {
+
+	if (depth < 1 || depth > _depths.size())
+		return nullptr;
+
+	return &_depths[depth - 1];
+}
+
+auto Sorcery::EncounterTable::_get_category(
+	const unsigned int depth, const Enums::Monsters::Category category) const
+	-> const Table * {
+
+	if (depth < 1 || depth > _categories.size())
+		return nullptr;
+
+	return &_categories[depth - 1][category];
+}
+
+auto Sorcery::EncounterTable::_draw(const Table *table,
+									const std::uint64_t bits) const
+	-> std::optional<Enums::Monsters::TypeID> {
+
+	if (table == nullptr || table->alias.empty())
+		return std::nullopt;
+
+	return table->types[table->alias.sample(bits)];
+}
+
+// Replaces the contents of types with draws using bits from the given source
+// (the system RNG or a worker's own); returns false (leaving it empty) if
+// there is nothing to draw
+template <class Bits>
+auto Sorcery::EncounterTable::_draw(const Table *table,
+									const unsigned int count,
+									std::vector<Enums::Monsters::TypeID> &types,
+									Bits &&bits) const -> bool {
+
+	types.clear();
+	if (table == nullptr || table->alias.empty())
+		return false;
+
+	types.reserve(count);
+	for (auto i = 0u; i < count; i++)
+		types.push_back(table->types[table->alias.sample(bits())]);
+
+	return true;
+}
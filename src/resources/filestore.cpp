@@ -49,6 +49,7 @@ Sorcery::FileStore::FileStore() {
 	_add_path(DOCUMENTS_DIR, LICENSE_FILE);
 	_add_path(GFX_DIR, BACKGROUND_MAIN_MENU_TEXTURE);
 	_add_path(GFX_DIR, BANNER_TEXTURE);
+	_add_path(GFX_DIR, DUNGEON_TEXTURE);
 	_add_path(GFX_DIR, ICONS_TEXTURE);
 	_add_path(GFX_DIR, ITEMS_TEXTURE);
 	_add_path(GFX_DIR, KNOWN_CREATURES_TEXTURE);
@@ -22,6 +22,8 @@
 
 #include "resources/imagestore.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
+#include "resources/textureatlas.hpp"
 #include "types/image.hpp"
 
 #pragma GCC diagnostic push
@@ -37,21 +39,46 @@ Sorcery::ImageStore::ImageStore(System *system)
 	_initialise();
 }
 
-auto Sorcery::ImageStore::get(const std::string file) -> Image {
+Sorcery::ImageStore::~ImageStore() {
 
-	if (!_loaded.at(file)) {
-		_load_image(file);
-		return _images.at(file);
-	} else
-		return _images.at(file);
+	for (auto &image : _images)
+		if (image.resident && !image.atlased)
+			glDeleteTextures(1, &image.texture);
+}
+
+// Get an image by handle, loading it first if needed
+auto Sorcery::ImageStore::get(const unsigned int handle) -> const Image & {
+
+	auto &image{_images.at(handle)};
+	if (!image.resident)
+		_load_image(handle);
+	image.last_frame = _frame;
+
+	return image;
+}
+
+auto Sorcery::ImageStore::get(std::string_view file) -> const Image & {
+
+	return get(handle(file));
+}
+
+auto Sorcery::ImageStore::handle(std::string_view file) const
+	-> unsigned int {
+
+	if (const auto it{_handles.find(file)}; it != _handles.end())
+		return it->second;
+	else
+		throw std::out_of_range(std::format("Unknown image '{}'", file));
 }
 
 auto Sorcery::ImageStore::_initialise() -> bool {
 
 	loaded = false;
 	_images.clear();
+	_handles.clear();
 	_sources.clear();
-	_loaded.clear();
+	_sheets.clear();
+	_atlases.clear();
 
 	// Work out what we need to load and just store it in a list
 	_sources.insert(
@@ -63,9 +90,34 @@ auto Sorcery::ImageStore::_initialise() -> bool {
 		 std::string{WIREFRAME_TEXTURE}});
 	capacity = _sources.size();
 
-	// Now set things as unloaded to begin with
-	for (const auto &source : _sources)
-		_loaded[source] = false;
+	// Tiled sprite sheets are small and used constantly, so share an atlas
+	_sheets.insert(_sheets.end(), {std::string{ICONS_TEXTURE},
+								   std::string{ITEMS_TEXTURE},
+								   std::string{KNOWN_CREATURES_TEXTURE},
+								   std::string{MAPS_TEXTURE},
+								   std::string{UNKNOWN_CREATURES_TEXTURE}});
+
+	// Now allocate a handle for each, with nothing loaded to begin with
+	_images.reserve(_sources.size());
+	for (const auto &source : _sources) {
+		_handles[source] = _images.size();
+		_images.emplace_back(source, 0, 0, 0);
+	}
+
+	// Work out how much VRAM we are allowed to use
+	const auto budget_mb{std::invoke([&] {
+		try {
+			const auto value{
+				_system->config->get("Graphics", TEXTURE_BUDGET_KEY)};
+			return value.empty() ? DEFAULT_TEXTURE_BUDGET_MB
+								 : static_cast<unsigned int>(std::stoul(value));
+		} catch (std::exception &) {
+			return DEFAULT_TEXTURE_BUDGET_MB;
+		}
+	})};
+	_budget = static_cast<std::size_t>(budget_mb) * 1024 * 1024;
+	_resident = 0;
+	_frame = 0;
 
 	progress = 1;
 	busy = false;
@@ -74,62 +126,130 @@ auto Sorcery::ImageStore::_initialise() -> bool {
 }
 
 // Load a specific image
-auto Sorcery::ImageStore::load_image(const std::string file) -> bool {
+auto Sorcery::ImageStore::load_image(std::string_view file) -> bool {
 
-	return _load_image(file);
+	return _load_image(handle(file));
 }
 
-auto Sorcery::ImageStore::has_loaded(const std::string file) -> bool {
+auto Sorcery::ImageStore::has_loaded(const unsigned int handle) const -> bool {
 
-	return _loaded.at(file);
+	return _images.at(handle).resident;
 }
 
-// Wrapper method to load an image
-auto Sorcery::ImageStore::_load_image(const std::string file) -> bool {
+auto Sorcery::ImageStore::has_loaded(std::string_view file) const -> bool {
 
-	// Check to make sure we don't reload an image (in future,
-	// store the file modified timestamp so we can dynamically
-	// reload images if we want to)
-	if (_loaded.at(file))
-		return false;
-	else {
-
-		// If not loaded, load the image
-		Image image{};
-		_load_texture_from_disc((*_system->files)[file].c_str(), &image.texture,
-								&image.width, &image.height);
-		_images.try_emplace(file, image);
-		_loaded[file] = true;
-		++progress;
-		return true;
-	}
+	return has_loaded(handle(file));
 }
 
-// Load an image file from disk into a texture (using stb)
-auto Sorcery::ImageStore::_load_texture_from_disc(const char *filename,
-												  GLuint *out_texture,
-												  int *out_width,
-												  int *out_height) -> bool {
+// Called at the start of every frame; anything touched during a frame is never
+// evicted until the next one as ImGui still has to draw it
+auto Sorcery::ImageStore::next_frame() -> void {
+
+	++_frame;
+}
+
+auto Sorcery::ImageStore::resident_bytes() const -> std::size_t {
+
+	return _resident;
+}
+
+// Load an image file from disk (using stb) and upload it to the GPU
+auto Sorcery::ImageStore::_load_image(const unsigned int handle) -> bool {
+
+	TRACE_SCOPE("ImageStore::_load_image");
+
+	auto &image{_images.at(handle)};
+	if (image.resident)
+		return false;
 
 	busy = true;
 
-	// Load from file
-	int image_width{0};
-	int image_height{0};
+	int width{0};
+	int height{0};
+	unsigned char *pixels{stbi_load((*_system->files)[image.key].c_str(),
+									&width, &height, nullptr, 4)};
+	if (pixels == nullptr) {
+		busy = false;
+		return false;
+	}
+
+	// Only count the first load of each image towards the loading screen
+	if (image.width == 0)
+		++progress;
+	image.width = width;
+	image.height = height;
+
+	const auto is_sheet{std::ranges::find(_sheets, image.key) != _sheets.end()};
+	if (!is_sheet || !_pack_into_atlas(image, pixels))
+		_upload_texture(image, pixels);
+	image.resident = true;
+	image.last_frame = _frame;
 
-	// Get image data
-	unsigned char *image_data{
-		stbi_load(filename, &image_width, &image_height, nullptr, 4)};
-	if (image_data == nullptr)
+	stbi_image_free(pixels);
+	busy = false;
+
+	return true;
+}
+
+// Try and find space for an image in one of the atlases, adding a new atlas if
+// none have room
+auto Sorcery::ImageStore::_pack_into_atlas(Image &image,
+										   const unsigned char *pixels)
+	-> bool {
+
+	TRACE_SCOPE("ImageStore::_pack_into_atlas");
+
+	if (image.width > ATLAS_MAX_IMAGE_SIZE ||
+		image.height > ATLAS_MAX_IMAGE_SIZE)
 		return false;
 
-	// Create a OpenGL texture identifier
-	GLuint image_texture;
-	glGenTextures(1, &image_texture);
-	glBindTexture(GL_TEXTURE_2D, image_texture);
+	auto place{[&](TextureAtlas *atlas) {
+		if (const auto rect{atlas->add(pixels, image.width, image.height)}) {
+			const auto size{atlas->get_size()};
+			image.texture = atlas->get_texture();
+			image.uv_min = ImVec2{rect->x / size.x, rect->y / size.y};
+			image.uv_max = ImVec2{(rect->x + rect->w) / size.x,
+								  (rect->y + rect->h) / size.y};
+			image.atlased = true;
+			image.bytes = 0;
+			return true;
+		} else
+			return false;
+	}};
+
+	for (auto &atlas : _atlases)
+		if (place(atlas.get()))
+			return true;
+
+	// Atlases are never evicted, but still count towards the budget
+	auto atlas{std::make_unique<TextureAtlas>(ATLAS_SIZE, ATLAS_SIZE)};
+	_evict(atlas->bytes());
+	_resident += atlas->bytes();
+	const auto placed{place(atlas.get())};
+	_atlases.emplace_back(std::move(atlas));
+
+	return placed;
+}
+
+// Upload an image as its own texture, mipmapped where OpenGL 3.0 is available
+auto Sorcery::ImageStore::_upload_texture(Image &image,
+										  const unsigned char *pixels) -> void {
+
+	TRACE_SCOPE("ImageStore::_upload_texture");
+
+	// A mipmap chain adds a third again
+	const auto mipmaps{GLEW_VERSION_3_0 != 0};
+	const auto base{static_cast<std::size_t>(image.width) * image.height * 4};
+	const auto bytes{mipmaps ? (base * 4) / 3 : base};
+	_evict(bytes);
+
+	GLuint texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
 
 	// Setup filtering parameters for display
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+					mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -138,18 +258,37 @@ auto Sorcery::ImageStore::_load_texture_from_disc(const char *filename,
 #if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
 	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0,
-				 GL_RGBA, GL_UNSIGNED_BYTE, image_data);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.width, image.height, 0,
+				 GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	if (mipmaps)
+		glGenerateMipmap(GL_TEXTURE_2D);
 
-	// Free up image data
-	stbi_image_free(image_data);
+	image.texture = texture;
+	image.uv_min = ImVec2{0.0f, 0.0f};
+	image.uv_max = ImVec2{1.0f, 1.0f};
+	image.atlased = false;
+	image.bytes = bytes;
+	_resident += bytes;
+}
 
-	// Pass back metadata needed for ImGui
-	*out_texture = image_texture;
-	*out_width = image_width;
-	*out_height = image_height;
+// Free standalone textures, oldest first, until there is room for the bytes
+// needed (anything used in the current frame is left alone)
+auto Sorcery::ImageStore::_evict(const std::size_t needed) -> void {
 
-	busy = false;
+	while (_resident + needed > _budget) {
 
-	return true;
-}
\ No newline at end of file
+		Image *oldest{nullptr};
+		for (auto &image : _images)
+			if (image.resident && !image.atlased && image.last_frame < _frame)
+				if (oldest == nullptr || image.last_frame < oldest->last_frame)
+					oldest = &image;
+		if (oldest == nullptr)
+			return;
+
+		glDeleteTextures(1, &oldest->texture);
+		oldest->texture = 0;
+		oldest->resident = false;
+		_resident -= oldest->bytes;
+		oldest->bytes = 0;
+	}
+}
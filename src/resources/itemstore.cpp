@@ -25,6 +25,7 @@
 #include "common/macro.hpp"
 #include "core/random.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 
 // Standard Constructor
 Sorcery::ItemStore::ItemStore(System *system,
@@ -39,6 +40,8 @@ Sorcery::ItemStore::ItemStore(System *system,
 
 auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 
+	TRACE_SCOPE("ItemStore::_load");
+
 	if (std::ifstream file{filename.string(), std::ifstream::binary};
 		file.good()) {
 
@@ -50,6 +53,7 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 		builder.settings_["indentation"] = "";
 		if (Json::Value data; reader.parse(file, data)) {
 			Json::Value &items{data["item"]};
+			_items.resize(magic_enum::enum_count<Enums::Items::TypeID>());
 
 			// Iterate through item file one itemtype at a time
 			for (auto i = 0u; i < items.size(); i++) {
@@ -292,8 +296,9 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 				item_type.set_buy(buy);
 				item_type.set_sell(sell);
 
-				_items[id.value()] = item_type;
+				_items.at(unenum(id.value())) = item_type;
 			}
+			_build_indexes();
 
 			return true;
 		} else
@@ -305,49 +310,45 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 }
 
 auto Sorcery::ItemStore::operator[](Enums::Items::TypeID item_type_id) const
-	-> ItemType {
+	-> const ItemType & {
 
-	return _items.at(item_type_id);
+	return _items.at(unenum(item_type_id));
 }
 
 auto Sorcery::ItemStore::operator[](unsigned int item_type_id) const
-	-> ItemType {
+	-> const ItemType & {
 
-	return _items.at(
-		magic_enum::enum_cast<Enums::Items::TypeID>(item_type_id).value());
+	return _items.at(item_type_id);
 }
 
 auto Sorcery::ItemStore::get_item_type(
-	const Enums::Items::TypeID item_type_id) const -> ItemType {
+	const Enums::Items::TypeID item_type_id) const -> const ItemType & {
 
-	return _items.at(item_type_id);
+	return _items.at(unenum(item_type_id));
 }
 
-auto Sorcery::ItemStore::operator[](std::string name) const -> ItemType {
+// Always assumes an item can be found
+auto Sorcery::ItemStore::operator[](std::string_view name) const
+	-> const ItemType & {
+
+	const auto it{_names.find(name)};
+	if (it == _names.end())
+		throw std::out_of_range{std::format("Unknown item type '{}'!", name)};
 
-	auto it{std::ranges::find_if(
-		_items.begin(), _items.end(), [&](const auto &item_type) {
-			return (item_type.second.get_display_name() == name);
-		})};
-	return (*it).second;
+	return _items.at(it->second);
 }
 
 auto Sorcery::ItemStore::operator()(const Enums::Items::Category category) const
-	-> std::vector<ItemType> {
-
-	std::vector<ItemType> items;
-	for (const auto &[key, value] : _items)
-		if (value.get_category() == category)
-			items.push_back(value);
+	-> std::span<const ItemType *const> {
 
-	return items;
+	return _categories.at(category);
 }
 
 // Public methods
 auto Sorcery::ItemStore::get_an_item(
 	const Enums::Items::TypeID item_type_id) const -> Item {
 
-	return Item{_items.at(item_type_id)};
+	return Item{_items.at(unenum(item_type_id))};
 }
 
 auto Sorcery::ItemStore::is_usable(const Enums::Items::TypeID item_type_id,
@@ -355,32 +356,32 @@ auto Sorcery::ItemStore::is_usable(const Enums::Items::TypeID item_type_id,
 								   const Enums::Character::Align calign) const
 	-> bool {
 
-	return _items.at(item_type_id).is_class_usable(cclass) &&
-		   _items.at(item_type_id).is_align_usable(calign);
+	return _items.at(unenum(item_type_id)).is_class_usable(cclass) &&
+		   _items.at(unenum(item_type_id)).is_align_usable(calign);
 }
 
 auto Sorcery::ItemStore::has_usable(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).has_usable();
+	return _items.at(unenum(item_type_id)).has_usable();
 }
 
 auto Sorcery::ItemStore::sellable_price(
 	const Enums::Items::TypeID item_type_id) const -> unsigned int {
 
-	return _items.at(item_type_id).get_value() / 2;
+	return _items.at(unenum(item_type_id)).get_value() / 2;
 }
 
 auto Sorcery::ItemStore::sellable_to_shop(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).get_buy();
+	return _items.at(unenum(item_type_id)).get_buy();
 }
 
 auto Sorcery::ItemStore::has_invokable(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).has_invokable();
+	return _items.at(unenum(item_type_id)).has_invokable();
 }
 
 auto Sorcery::ItemStore::get_random_item(
@@ -390,17 +391,24 @@ auto Sorcery::ItemStore::get_random_item(
 	auto item_type_id{_system->random->get(unenum(min_item_type_id),
 										   unenum(max_item_type_id))};
 
-	return Item{_items.at(
-		magic_enum::enum_cast<Enums::Items::TypeID>(item_type_id).value())};
+	return Item{_items.at(item_type_id)};
 }
 
-auto Sorcery::ItemStore::get_all_types() const -> std::vector<ItemType> {
+auto Sorcery::ItemStore::get_all_types() const -> std::span<const ItemType> {
 
-	std::vector<ItemType> items;
-	for (const auto &[key, value] : _items)
-		items.push_back(value);
+	return _items;
+}
 
-	return items;
+// Called once all the items have been loaded (and so won't move in memory)
+auto Sorcery::ItemStore::_build_indexes() -> void {
+
+	_names.clear();
+	_categories.clear();
+	for (const auto &item_type : _items) {
+		_names.try_emplace(item_type.get_display_name(),
+						   unenum(item_type.get_type_id()));
+		_categories[item_type.get_category()].push_back(&item_type);
+	}
 }
 
 auto Sorcery::ItemStore::_get_defensive_effects(
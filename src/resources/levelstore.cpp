@@ -25,6 +25,7 @@
 #include "common/macro.hpp"
 #include "core/random.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 
 Sorcery::LevelStore::LevelStore() {
 	_levels.clear();
@@ -92,6 +93,8 @@ auto Sorcery::LevelStore::_get(const int depth) const -> std::optional<Level> {
 
 auto Sorcery::LevelStore::_load(const std::filesystem::path filename) -> bool {
 
+	TRACE_SCOPE("LevelStore::_load");
+
 	try {
 
 		if (std::ifstream file{filename.string(), std::ifstream::binary};
@@ -0,0 +1,160 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "resources/loottable.hpp"
+#include "core/random.hpp"
+#include "core/system.hpp"
+#include "resources/itemstore.hpp"
+
+// Items that can't be bought or sold (quest items, keys and the like) never
+// turn up; the weight of the rest falls off with their price, from one over
+// the price on the first level to nearly flat on the last
+Sorcery::LootTable::LootTable(System *system, const ItemStore &items)
+	: _system{system} {
+
+	std::vector<const ItemType *> found{};
+	for (const auto &item_type : items.get_all_types())
+		if (item_type.get_value() > 0 &&
+			item_type.get_value() <= LOOT_MAX_VALUE &&
+			item_type.get_category() != Enums::Items::Category::SPECIAL_ITEM)
+			found.push_back(&item_type);
+
+	std::vector<double> weights{};
+	for (auto level = 0u; level < LOOT_LEVELS; level++) {
+		const auto exponent{1.0 - static_cast<double>(level) / LOOT_LEVELS};
+		auto &table{_levels[level]};
+		weights.clear();
+		for (const auto *item_type : found) {
+			table.types.push_back(item_type->get_type_id());
+			weights.push_back(std::pow(
+				static_cast<double>(item_type->get_value()), -exponent));
+		}
+		table.alias = AliasTable{weights};
+	}
+
+	for (auto &[category, table] : _categories) {
+		weights.clear();
+		for (const auto *item_type : found)
+			if (item_type->get_category() == category) {
+				table.types.push_back(item_type->get_type_id());
+				weights.push_back(
+					1.0 / static_cast<double>(item_type->get_value()));
+			}
+		table.alias = AliasTable{weights};
+	}
+}
+
+// Levels start at 1; deeper than the last uses the last
+auto Sorcery::LootTable::draw(const unsigned int level) const
+	-> std::optional<Enums::Items::TypeID> {
+
+	return _draw(_get_level(level), _system->random->get_bits());
+}
+
+auto Sorcery::LootTable::draw(const unsigned int level,
+							  std::mt19937_64 &random) const
+	-> std::optional<Enums::Items::TypeID> {
+
+	return _draw(_get_level(level), random());
+}
+
+auto Sorcery::LootTable::draw(const unsigned int level,
+							  const unsigned int count,
+							  std::vector<Enums::Items::TypeID> &types) const
+	-> bool {
+
+	return _draw(_get_level(level), count, types,
+				 [this] { return _system->random->get_bits(); });
+}
+
+auto Sorcery::LootTable::draw(const unsigned int level,
+							  const unsigned int count,
+							  std::vector<Enums::Items::TypeID> &types,
+							  std::mt19937_64 &random) const -> bool {
+
+	return _draw(_get_level(level), count, types, random);
+}
+
+auto Sorcery::LootTable::draw(const Enums::Items::Category category) const
+	-> std::optional<Enums::Items::TypeID> {
+
+	return _draw(_categories[category], _system->random->get_bits());
+}
+
+auto Sorcery::LootTable::draw(const Enums::Items::Category category,
+							  std::mt19937_64 &random) const
+	-> std::optional<Enums::Items::TypeID> {
+
+	return _draw(_categories[category], random());
+}
+
+auto Sorcery::LootTable::draw(const Enums::Items::Category category,
+							  const unsigned int count,
+							  std::vector<Enums::Items::TypeID> &types) const
+	-> bool {
+
+	return _draw(_categories[category], count, types,
+				 [this] { return _system->random->get_bits(); });
+}
+
+auto Sorcery::LootTable::draw(const Enums::Items::Category category,
+							  const unsigned int count,
+							  std::vector<Enums::Items::TypeID> &types,
+							  std::mt19937_64 &random) const -> bool {
+
+	return _draw(_categories[category], count, types, random);
+}
+
+auto Sorcery::LootTable::_get_level(const unsigned int level) const
+	-> const Table & {
+
+	return _levels[std::clamp(level, 1u, LOOT_LEVELS) - 1];
+}
+
+auto Sorcery::LootTable::_draw(const Table &table,
+							   const std::uint64_t bits) const
+	-> std::optional<Enums::Items::TypeID> {
+
+	if (table.alias.empty())
+		return std::nullopt;
+
+	return table.types[table.alias.sample(bits)];
+}
+
+// Replaces the contents of types with draws using bits from the given source
+// (the system RNG or a worker's own); returns false (leaving it empty) if
+// there is nothing to draw
+template <class Bits>
+auto Sorcery::LootTable::_draw(const Table &table, const unsigned int count,
+							   std::vector<Enums::Items::TypeID> &types,
+							   Bits &&bits) const -> bool {
+
+	types.clear();
+	if (table.alias.empty())
+		return false;
+
+	types.reserve(count);
+	for (auto i = 0u; i < count; i++)
+		types.push_back(table.types[table.alias.sample(bits())]);
+
+	return true;
+}
@@ -25,6 +25,7 @@
 #include "common/include.hpp"
 #include "common/macro.hpp"
 #include "core/system.hpp"
+#include "core/trace.hpp"
 #include "resources/define.hpp"
 #include "resources/include.hpp"
 #include "types/monstertype.hpp"
@@ -43,6 +44,8 @@ Sorcery::MonsterStore::MonsterStore(System *system,
 auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 	-> bool {
 
+	TRACE_SCOPE("MonsterStore::_load");
+
 	if (std::ifstream file{filename.string(), std::ifstream::binary};
 		file.good()) {
 
@@ -54,6 +57,7 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 		builder.settings_["indentation"] = "";
 		if (Json::Value data; reader.parse(file, data)) {
 			Json::Value &items{data["monster"]};
+			_items.resize(magic_enum::enum_count<Enums::Monsters::TypeID>());
 
 			// Iterate through item file one itemtype at a time
 			for (auto i = 0u; i < items.size(); i++) {
@@ -215,8 +219,9 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 				monster_type.set_traits(traits);
 				monster_type.set_weaknesses(weaknesses);
 
-				_items[id.value()] = monster_type;
+				_items.at(unenum(id.value())) = monster_type;
 			}
+			_build_indexes();
 
 			return true;
 		} else
@@ -228,26 +233,42 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 }
 
 auto Sorcery::MonsterStore::operator[](
-	Enums::Monsters::TypeID monster_type_id) const -> MonsterType {
+	Enums::Monsters::TypeID monster_type_id) const -> const MonsterType & {
 
-	return _items.at(monster_type_id);
+	return _items.at(unenum(monster_type_id));
 }
 
 auto Sorcery::MonsterStore::operator[](int monster_type_id) const
-	-> MonsterType {
+	-> const MonsterType & {
 
-	return _items.at(
-		magic_enum::enum_cast<Enums::Monsters::TypeID>(monster_type_id)
-			.value());
+	return _items.at(monster_type_id);
 }
 
-auto Sorcery::MonsterStore::get_all_types() const -> std::vector<MonsterType> {
+// Always assumes a monster can be found
+auto Sorcery::MonsterStore::operator[](std::string_view name) const
+	-> const MonsterType & {
+
+	const auto it{_names.find(name)};
+	if (it == _names.end())
+		throw std::out_of_range{
+			std::format("Unknown monster type '{}'!", name)};
+
+	return _items.at(it->second);
+}
+
+auto Sorcery::MonsterStore::get_all_types() const
+	-> std::span<const MonsterType> {
+
+	return _items;
+}
 
-	std::vector<MonsterType> items;
-	for (const auto &[key, value] : _items)
-		items.push_back(value);
+// Called once all the monsters have been loaded
+auto Sorcery::MonsterStore::_build_indexes() -> void {
 
-	return items;
+	_names.clear();
+	for (const auto &monster_type : _items)
+		_names.try_emplace(monster_type.get_known_name(),
+						   unenum(monster_type.get_type_id()));
 }
 
 auto Sorcery::MonsterStore::_parse_attacks(const std::string value) const
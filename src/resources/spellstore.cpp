@@ -33,46 +33,71 @@ Sorcery::SpellStore::SpellStore(System *system)
 }
 
 auto Sorcery::SpellStore::operator[](Enums::Magic::SpellID spell_id) const
-	-> Spell {
+	-> const Spell & {
 
 	// Always assumes a spell can be found
-	auto it{std::ranges::find_if(_spells.begin(), _spells.end(),
-								 [&](const auto &spell) {
-									 return (spell.id == spell_id);
-								 })};
-	return (*it);
+	return _spells[_index.at(unenum(spell_id))];
 }
 
 auto Sorcery::SpellStore::operator()(Enums::Magic::SpellCategory category) const
 	-> std::vector<Spell> {
 
-	auto spells{_spells | std::views::filter([&](Spell spell) {
+	auto spells{_spells | std::views::filter([&](const Spell &spell) {
 					return spell.category == category;
 				})};
 
 	std::vector<Spell> filtered;
 	filtered.clear();
-	for (auto spell : spells)
+	for (const auto &spell : spells)
 		filtered.emplace_back(spell);
 
 	return filtered;
 }
 
-auto Sorcery::SpellStore::operator[](std::string name) const -> Spell {
+auto Sorcery::SpellStore::operator[](std::string_view name) const
+	-> const Spell & {
 
-	// Always assumes a spell can be found
-	auto it{std::ranges::find_if(_spells.begin(), _spells.end(),
-								 [&](const auto &spell) {
-									 return (spell.name == name);
-								 })};
-	return (*it);
+	const auto it{_names.find(name)};
+	if (it == _names.end())
+		throw std::out_of_range{std::format("Unknown spell '{}'!", name)};
+
+	return _spells.at(it->second);
 }
 
-auto Sorcery::SpellStore::get_all() -> std::vector<Spell> {
+auto Sorcery::SpellStore::get_all() const -> const std::vector<Spell> & {
 
 	return _spells;
 }
 
+// All the spells of one type and level, for counting against a known bitset
+auto Sorcery::SpellStore::get_mask(const Enums::Magic::SpellType type,
+								   const unsigned int level) const
+	-> const std::bitset<NUM_SPELLS> & {
+
+	return _masks.at(type == Enums::Magic::SpellType::DIVINE ? 1 : 0)
+		.at(level);
+}
+
+// Work out where each spell is so that lookups by id don't need a search
+auto Sorcery::SpellStore::_build_index() -> void {
+
+	_index.fill(0);
+	_names.clear();
+	for (auto &masks : _masks)
+		for (auto &mask : masks)
+			mask.reset();
+
+	for (auto i = 0u; i < _spells.size(); i++) {
+		const auto &spell{_spells[i]};
+		const auto id{static_cast<std::size_t>(unenum(spell.id))};
+		_index[id] = i;
+		_names.try_emplace(spell.name, i);
+		_masks[spell.type == Enums::Magic::SpellType::DIVINE ? 1 : 0]
+			  [spell.level]
+				  .set(id);
+	}
+}
+
 // Not sure why they are loaded here as opposed to a file
 auto Sorcery::SpellStore::_load() -> void {
 
@@ -329,5 +354,6 @@ auto Sorcery::SpellStore::_load() -> void {
 						 (*_system->strings)["SPELL_MALIKTO_TITLE"],
 						 (*_system->strings)["SPELL_MALIKTO_DESC"]);
 
+	_build_index();
 	_loaded = true;
 }
\ No newline at end of file
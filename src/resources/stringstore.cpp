@@ -21,6 +21,7 @@
 // the resulting work.
 
 #include "resources/stringstore.hpp"
+#include "core/trace.hpp"
 #include "resources/define.hpp"
 #include "resources/include.hpp"
 
@@ -31,9 +32,59 @@ Sorcery::StringStore::StringStore(const std::string &filename)
 	_loaded = _load();
 }
 
-auto Sorcery::StringStore::operator[](std::string_view key) -> std::string & {
+auto Sorcery::StringStore::operator[](std::string_view key) const
+	-> const std::string & {
 
-	return _loaded ? _strings[std::string{key}] : _strings["NONE"];
+	// Components with no text (such as untitled modals) use an empty key
+	static const std::string empty{};
+	if (key.empty())
+		return empty;
+
+	if (!_loaded)
+		return STRINGS_NOT_LOADED;
+
+	if (const auto it{_index.find(key)}; it != _index.end())
+		return _values[it->second];
+	else
+		return KEY_NOT_FOUND;
+}
+
+auto Sorcery::StringStore::get(std::string_view key) const
+	-> std::string_view {
+
+	return (*this)[key];
+}
+
+auto Sorcery::StringStore::contains(std::string_view key) const -> bool {
+
+	return _index.contains(key);
+}
+
+// Report any keys that are used but are not in the strings file
+auto Sorcery::StringStore::check(std::string_view source,
+								 std::span<const std::string> keys) const
+	-> unsigned int {
+
+	auto missing{0u};
+	if (_loaded)
+		for (const auto &key : keys)
+			if (!_check(source, key))
+				++missing;
+
+	return missing;
+}
+
+auto Sorcery::StringStore::check(std::string_view source,
+								 std::span<const std::string_view> keys) const
+	-> unsigned int {
+
+	auto missing{0u};
+	if (_loaded)
+		for (const auto key : keys)
+			if (!_check(source, key))
+				++missing;
+
+	return missing;
 }
 
 auto Sorcery::StringStore::reload() -> void {
@@ -41,11 +92,29 @@ auto Sorcery::StringStore::reload() -> void {
 	_loaded = _load();
 }
 
+// Reports a key that is not in the strings file
+auto Sorcery::StringStore::_check(std::string_view source,
+								  std::string_view key) const -> bool {
+
+	if (key.empty() || _index.contains(key))
+		return true;
+
+	std::out_of_range exception{std::string{key}};
+	Error error{Enums::System::Error::UNKNOWN_STRING_KEY, exception,
+				std::format("String '{}' used in {} is not in {}!", key, source,
+							STRINGS_FILE)};
+	std::cerr << error;
+
+	return false;
+}
+
 auto Sorcery::StringStore::_load() -> bool {
 
+	TRACE_SCOPE("StringStore::_load");
+
 	// Attempt to load the Strings File
-	_strings.clear();
-	_strings["NONE"] = STRINGS_NOT_LOADED;
+	_values.clear();
+	_index.clear();
 	if (std::ifstream file{_filename, std::ifstream::binary}; file.good()) {
 
 		// Iterate through the file
@@ -57,6 +126,8 @@ auto Sorcery::StringStore::_load() -> bool {
 		Json::StreamWriterBuilder builder{};
 		builder.settings_["indentation"] = "";
 		if (reader.parse(file, root, false)) {
+			_values.reserve(root.size());
+			_index.reserve(root.size());
 			for (Json::Value::iterator it = root.begin(); it != root.end();
 				 ++it) {
 				Json::Value key{it.key()};
@@ -75,8 +146,14 @@ auto Sorcery::StringStore::_load() -> bool {
 					remove(string_key.begin(), string_key.end(), '\n'),
 					string_key.end());
 
-				// Insert it into the map
-				_strings[string_key] = string_value;
+				// Insert it into the table (later duplicates win, as before)
+				if (const auto existing{_index.find(string_key)};
+					existing != _index.end())
+					_values[existing->second] = std::move(string_value);
+				else {
+					_index.emplace(std::move(string_key), _values.size());
+					_values.emplace_back(std::move(string_value));
+				}
 			}
 		} else
 			return false;
@@ -85,13 +162,3 @@ auto Sorcery::StringStore::_load() -> bool {
 
 	return true;
 }
-
-auto Sorcery::StringStore::get(std::string_view key) -> std::string {
-
-	if (_loaded)
-		return _strings.contains(std::string{key})
-				   ? _strings.at(std::string{key})
-				   : KEY_NOT_FOUND;
-	else
-		return STRINGS_NOT_LOADED;
-}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "resources/textureatlas.hpp"
+#include "resources/define.hpp"
+
+Sorcery::TextureAtlas::TextureAtlas(const int width, const int height)
+	: _width{width},
+	  _height{height} {
+
+	_shelf_x = 0;
+	_shelf_y = 0;
+	_shelf_h = 0;
+
+	// Allocate the texture up front, cleared so that the padding between
+	// images is transparent, and copy images in as they are added. There are
+	// no mipmaps, as the smaller levels would blend neighbouring images
+	const std::vector<unsigned char> clear(
+		static_cast<std::size_t>(_width) * _height * 4, 0);
+	glGenTextures(1, &_texture);
+	glBindTexture(GL_TEXTURE_2D, _texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, _width, _height, 0, GL_RGBA,
+				 GL_UNSIGNED_BYTE, clear.data());
+}
+
+Sorcery::TextureAtlas::~TextureAtlas() {
+
+	glDeleteTextures(1, &_texture);
+}
+
+// Copy an image into the next free space, returning where it was put or
+// nothing if there is no room left in this atlas
+auto Sorcery::TextureAtlas::add(const unsigned char *pixels, const int width,
+								const int height) -> std::optional<Rect> {
+
+	const auto padded_w{width + (ATLAS_PADDING * 2)};
+	const auto padded_h{height + (ATLAS_PADDING * 2)};
+	if (padded_w > _width || padded_h > _height)
+		return std::nullopt;
+
+	// Start a new shelf if this one is full
+	if (_shelf_x + padded_w > _width) {
+		_shelf_y += _shelf_h;
+		_shelf_x = 0;
+		_shelf_h = 0;
+	}
+	if (_shelf_y + padded_h > _height)
+		return std::nullopt;
+
+	const Rect dest{static_cast<unsigned int>(_shelf_x + ATLAS_PADDING),
+					static_cast<unsigned int>(_shelf_y + ATLAS_PADDING),
+					static_cast<unsigned int>(width),
+					static_cast<unsigned int>(height)};
+	_shelf_x += padded_w;
+	_shelf_h = std::max(_shelf_h, padded_h);
+
+	glBindTexture(GL_TEXTURE_2D, _texture);
+#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+	glTexSubImage2D(GL_TEXTURE_2D, 0, dest.x, dest.y, width, height, GL_RGBA,
+					GL_UNSIGNED_BYTE, pixels);
+
+	return dest;
+}
+
+// Approximate VRAM used
+auto Sorcery::TextureAtlas::bytes() const -> std::size_t {
+
+	return static_cast<std::size_t>(_width) * _height * 4;
+}
+
+auto Sorcery::TextureAtlas::get_texture() const -> GLuint {
+
+	return _texture;
+}
+
+auto Sorcery::TextureAtlas::get_size() const -> ImVec2 {
+
+	return ImVec2{static_cast<float>(_width), static_cast<float>(_height)};
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "types/aliastable.hpp"
+
+// Built with Vose's version of the method. Weights that are negative (or not
+// numbers) count as zero; if none are positive every index is equally likely
+Sorcery::AliasTable::AliasTable(std::span<const double> weights) {
+
+	const auto count{weights.size()};
+	if (count == 0)
+		return;
+
+	std::vector<double> scaled(count, 0.0);
+	auto total{0.0};
+	for (auto i = 0u; i < count; i++)
+		if (weights[i] > 0.0)
+			total += weights[i];
+	for (auto i = 0u; i < count; i++)
+		scaled[i] = total > 0.0 ? (weights[i] > 0.0 ? weights[i] : 0.0) *
+									  static_cast<double>(count) / total
+								: 1.0;
+
+	// Columns under the average take what they are short by from one over it
+	std::vector<unsigned int> small{};
+	std::vector<unsigned int> large{};
+	for (auto i = 0u; i < count; i++)
+		(scaled[i] < 1.0 ? small : large).push_back(i);
+
+	_thresholds.assign(count, ALIAS_ALWAYS);
+	_aliases.resize(count);
+	for (auto i = 0u; i < count; i++)
+		_aliases[i] = i;
+	while (!small.empty() && !large.empty()) {
+		const auto less{small.back()};
+		small.pop_back();
+		const auto more{large.back()};
+		_thresholds[less] =
+			static_cast<std::uint64_t>(scaled[less] * ALIAS_ALWAYS);
+		_aliases[less] = more;
+		scaled[more] -= 1.0 - scaled[less];
+		if (scaled[more] < 1.0) {
+			large.pop_back();
+			small.push_back(more);
+		}
+	}
+
+	// Anything left over is only off the average by rounding
+}
+
+auto Sorcery::AliasTable::empty() const -> bool {
+
+	return _thresholds.empty();
+}
+
+auto Sorcery::AliasTable::size() const -> unsigned int {
+
+	return static_cast<unsigned int>(_thresholds.size());
+}
+
+// The top 32 bits pick the column and the bottom 32 bits pick between it and
+// its alias; must not be called on an empty table
+auto Sorcery::AliasTable::sample(const std::uint64_t bits) const
+	-> unsigned int {
+
+	const auto column{static_cast<unsigned int>(((bits >> 32) * size()) >> 32)};
+
+	return (bits & 0xffffffffull) < _thresholds[column] ? column
+													   : _aliases[column];
+}
@@ -25,12 +25,14 @@
 #include "core/resources.hpp"
 #include "core/system.hpp"
 
-Sorcery::Character::Character() {}
+Sorcery::Character::Character()
+	: _revision{++s_revision} {}
 
 // Standard Constructor
 Sorcery::Character::Character(System *system, Resources *resources)
 	: _system{system},
-	  _resources{resources} {
+	  _resources{resources},
+	  _revision{++s_revision} {
 
 	set_stage(Enums::Character::Stage::CHOOSE_METHOD);
 
@@ -71,6 +73,7 @@ auto Sorcery::Character::get_location() const -> Enums::Character::Location {
 auto Sorcery::Character::set_location(const Enums::Character::Location value)
 	-> void {
 
+	_bump_revision();
 	_location = value;
 
 	using enum Enums::Character::Location;
@@ -80,43 +83,68 @@ auto Sorcery::Character::set_location(const Enums::Character::Location value)
 	}
 }
 
-auto Sorcery::Character::abilities()
-	-> std::map<Enums::Character::Ability, int> & {
+auto Sorcery::Character::abilities() -> Abilities & {
 
+	_bump_revision();
 	return _abilities;
 }
 
-auto Sorcery::Character::spells() -> std::vector<Spell> & {
+auto Sorcery::Character::abilities() const -> const Abilities & {
 
-	return _spells;
+	return _abilities;
 }
 
-auto Sorcery::Character::attributes()
-	-> std::map<Enums::Character::Attribute, int> & {
+auto Sorcery::Character::attributes() -> Attributes & {
 
+	_bump_revision();
 	return _cur_attr;
 }
 
-auto Sorcery::Character::priest_cur_sp()
-	-> std::map<unsigned int, unsigned int> & {
+auto Sorcery::Character::attributes() const -> const Attributes & {
+
+	return _cur_attr;
+}
+
+auto Sorcery::Character::priest_cur_sp() -> SpellPoints & {
+
+	_bump_revision();
+	return _priest_cur_sp;
+}
+
+auto Sorcery::Character::priest_cur_sp() const -> const SpellPoints & {
 
 	return _priest_cur_sp;
 }
 
-auto Sorcery::Character::mage_cur_sp()
-	-> std::map<unsigned int, unsigned int> & {
+auto Sorcery::Character::mage_cur_sp() -> SpellPoints & {
 
+	_bump_revision();
 	return _mage_cur_sp;
 }
 
-auto Sorcery::Character::priest_max_sp()
-	-> std::map<unsigned int, unsigned int> & {
+auto Sorcery::Character::mage_cur_sp() const -> const SpellPoints & {
+
+	return _mage_cur_sp;
+}
+
+auto Sorcery::Character::priest_max_sp() -> SpellPoints & {
+
+	_bump_revision();
+	return _priest_max_sp;
+}
+
+auto Sorcery::Character::priest_max_sp() const -> const SpellPoints & {
 
 	return _priest_max_sp;
 }
 
-auto Sorcery::Character::mage_max_sp()
-	-> std::map<unsigned int, unsigned int> & {
+auto Sorcery::Character::mage_max_sp() -> SpellPoints & {
+
+	_bump_revision();
+	return _mage_max_sp;
+}
+
+auto Sorcery::Character::mage_max_sp() const -> const SpellPoints & {
 
 	return _mage_max_sp;
 }
@@ -125,6 +153,7 @@ auto Sorcery::Character::mage_max_sp()
 auto Sorcery::Character::set_stage(const Enums::Character::Stage stage)
 	-> void {
 
+	_bump_revision();
 	_current_stage = stage;
 	switch (stage) {
 		using enum Enums::Character::Stage;
@@ -149,9 +178,7 @@ auto Sorcery::Character::set_stage(const Enums::Character::Stage stage)
 		_priest_cur_sp.clear();
 		_mage_max_sp.clear();
 		_mage_cur_sp.clear();
-		_spells.clear();
-		create_spells();
-		reset_spells();
+		_spells_known.reset();
 		break;
 	case REVIEW_AND_CONFIRM:
 
@@ -183,6 +210,7 @@ auto Sorcery::Character::get_name_and_loc() const -> std::string {
 
 auto Sorcery::Character::set_name(std::string_view value) -> void {
 
+	_bump_revision();
 	_name = value;
 }
 
@@ -193,6 +221,7 @@ auto Sorcery::Character::get_race() const -> Enums::Character::Race {
 
 auto Sorcery::Character::set_race(const Enums::Character::Race &value) -> void {
 
+	_bump_revision();
 	_race = value;
 }
 
@@ -203,6 +232,7 @@ auto Sorcery::Character::get_level() const -> int {
 
 auto Sorcery::Character::set_level(const int &value) -> void {
 
+	_bump_revision();
 	_abilities.at(Enums::Character::Ability::CURRENT_LEVEL) = value;
 }
 
@@ -214,6 +244,7 @@ auto Sorcery::Character::get_alignment() const -> Enums::Character::Align {
 auto Sorcery::Character::set_alignment(const Enums::Character::Align &value)
 	-> void {
 
+	_bump_revision();
 	_alignment = value;
 }
 
@@ -230,6 +261,7 @@ auto Sorcery::Character::get_class() const -> Enums::Character::Class {
 auto Sorcery::Character::set_class(const Enums::Character::Class &value)
 	-> void {
 
+	_bump_revision();
 	_class = value;
 }
 
@@ -240,6 +272,7 @@ auto Sorcery::Character::get_points_left() const -> unsigned int {
 
 auto Sorcery::Character::set_points_left(const unsigned int &value) -> void {
 
+	_bump_revision();
 	_points_left = value;
 }
 
@@ -250,6 +283,7 @@ auto Sorcery::Character::get_start_points() const -> unsigned int {
 
 auto Sorcery::Character::set_start_points(const unsigned int &value) -> void {
 
+	_bump_revision();
 	_st_points = value;
 }
 
@@ -268,6 +302,7 @@ auto Sorcery::Character::get_start_attr(
 auto Sorcery::Character::set_cur_attr(
 	const Enums::Character::Attribute attribute, const int adjustment) -> void {
 
+	_bump_revision();
 	_cur_attr.at(attribute) += adjustment;
 }
 
@@ -278,11 +313,13 @@ auto Sorcery::Character::get_portrait_index() const -> unsigned int {
 
 auto Sorcery::Character::set_portrait_index(const unsigned int value) -> void {
 
+	_bump_revision();
 	_portrait_index = value;
 }
 
 auto Sorcery::Character::set_start_attr() -> void {
 
+	_bump_revision();
 	_start_attr.clear();
 	_cur_attr.clear();
 	switch (_race) {
@@ -329,20 +366,18 @@ auto Sorcery::Character::set_start_attr() -> void {
 	_st_points = _points_left;
 }
 
-auto Sorcery::Character::get_cur_attr() const
-	-> std::map<Enums::Character::Attribute, int> {
+auto Sorcery::Character::get_cur_attr() const -> const Attributes & {
 
 	return _cur_attr;
 }
 
-auto Sorcery::Character::get_start_attr() const
-	-> std::map<Enums::Character::Attribute, int> {
+auto Sorcery::Character::get_start_attr() const -> const Attributes & {
 
 	return _start_attr;
 }
 
 auto Sorcery::Character::get_pos_class() const
-	-> std::map<Enums::Character::Class, bool> {
+	-> const EnumMap<Enums::Character::Class, bool> & {
 
 	return _pos_classes;
 }
@@ -351,6 +386,7 @@ auto Sorcery::Character::get_pos_class() const
 // available
 auto Sorcery::Character::set_pos_class() -> void {
 
+	_bump_revision();
 	_pos_classes.clear();
 
 	// Do the basic classes first (this also sets
@@ -479,6 +515,7 @@ auto Sorcery::Character::class_to_str(
 // Last step of creating new a character
 auto Sorcery::Character::finalise() -> void {
 
+	_bump_revision();
 	_generate_start_info();
 	_generate_secondary_abil(true, false, false);
 	_set_start_spells();
@@ -493,6 +530,7 @@ auto Sorcery::Character::get_ress_chance(bool ashes) -> unsigned int {
 
 auto Sorcery::Character::grant_gold(const int value) -> void {
 
+	_bump_revision();
 	_abilities[Enums::Character::Ability::GOLD] =
 		_abilities[Enums::Character::Ability::GOLD] + value;
 }
@@ -504,6 +542,7 @@ auto Sorcery::Character::get_gold() const -> unsigned int {
 
 auto Sorcery::Character::set_gold(const unsigned int value) -> void {
 
+	_bump_revision();
 	_abilities[Enums::Character::Ability::GOLD] = value;
 }
 
@@ -605,7 +644,7 @@ auto Sorcery::Character::_regenerate_start_info() -> void {
 	_abilities[AGE] += age_increment;
 
 	// Reset attributes to racial minimums
-	std::map<Enums::Character::Attribute, int> minimum_attr;
+	Attributes minimum_attr;
 	switch (_race) {
 		using enum Enums::Character::Race;
 		using enum Enums::Character::Attribute;
@@ -640,6 +679,7 @@ auto Sorcery::Character::_regenerate_start_info() -> void {
 // Legate
 auto Sorcery::Character::legate(const Enums::Character::Align &value) -> void {
 
+	_bump_revision();
 	if (_alignment != value)
 		_alignment = value;
 
@@ -658,6 +698,7 @@ auto Sorcery::Character::legate(const Enums::Character::Align &value) -> void {
 auto Sorcery::Character::change_class(const Enums::Character::Class &value)
 	-> void {
 
+	_bump_revision();
 	if (_class != value) {
 		_class = value;
 
@@ -679,6 +720,20 @@ auto Sorcery::Character::get_version() const -> int {
 	return _version;
 }
 
+// Changes whenever anything displayed about the character (including their
+// inventory) might have changed; revisions are never reused, even across
+// characters, so they can be used to key cached text
+auto Sorcery::Character::get_revision() const -> std::uint64_t {
+
+	return (static_cast<std::uint64_t>(_revision) << 32) |
+		   inventory.get_revision();
+}
+
+auto Sorcery::Character::_bump_revision() -> void {
+
+	_revision = ++s_revision;
+}
+
 // Work out all the stuff to do with starting a new character
 auto Sorcery::Character::_generate_start_info() -> void {
 
@@ -1164,6 +1219,7 @@ auto Sorcery::Character::_generate_secondary_abil(bool initial,
 
 auto Sorcery::Character::grant_xp(const int adjustment) -> int {
 
+	_bump_revision();
 	using enum Enums::Character::Ability;
 	_abilities[CURRENT_XP] = _abilities[CURRENT_XP] + adjustment;
 
@@ -1179,23 +1235,16 @@ auto Sorcery::Character::_reset_starting_sp() -> void {
 	for (auto spell_level = 1u; spell_level <= 7u; spell_level++) {
 
 		// Handle Priest Spells
-		auto priest_known{static_cast<unsigned int>(
-			std::count_if(_spells.begin(), _spells.end(), [=](auto spell) {
-				return (spell.type == Enums::Magic::SpellType::DIVINE) &&
-					   (spell.level == spell_level) && (spell.known);
-			}))};
-
+		const auto priest_known{
+			_get_spells_known(Enums::Magic::SpellType::DIVINE, spell_level)};
 		if (_priest_max_sp[spell_level] < priest_known) {
 			_priest_max_sp[spell_level] = priest_known;
 			_priest_cur_sp[spell_level] = _priest_max_sp[spell_level];
 		}
 
 		// Handle Mage Spells
-		auto mage_known{static_cast<unsigned int>(
-			std::count_if(_spells.begin(), _spells.end(), [=](auto spell) {
-				return (spell.type == Enums::Magic::SpellType::ARCANE) &&
-					   (spell.level == spell_level) && (spell.known);
-			}))};
+		const auto mage_known{
+			_get_spells_known(Enums::Magic::SpellType::ARCANE, spell_level)};
 		if (_mage_max_sp[spell_level] < mage_known) {
 			_mage_max_sp[spell_level] = mage_known;
 			_mage_cur_sp[spell_level] = _mage_max_sp[spell_level];
@@ -1257,14 +1306,17 @@ auto Sorcery::Character::_reset_start_spells() -> void {
 
 auto Sorcery::Character::_learn_spell(Enums::Magic::SpellID spell_id) -> void {
 
-	std::vector<Spell>::iterator it;
-	it = std::find_if(_spells.begin(), _spells.end(), [&](auto item) {
-		return item.id == spell_id;
-	});
-	if (it != _spells.end()) {
-		(*it).known = true;
-		_spells_known[(*it).id] = true;
-	} // NOLINT(clang-di
+	if (spell_id != Enums::Magic::SpellID::NO_SPELL)
+		_spells_known.set(unenum(spell_id));
+}
+
+auto Sorcery::Character::knows_spell(const Enums::Magic::SpellID spell_id) const
+	-> bool {
+
+	if (spell_id == Enums::Magic::SpellID::NO_SPELL)
+		return false;
+
+	return _spells_known.test(unenum(spell_id));
 }
 
 // Set starting spells
@@ -1407,6 +1459,7 @@ auto Sorcery::Character::_update_stat_for_level(
 // Level a character up
 auto Sorcery::Character::level_up() -> void {
 
+	_bump_revision();
 	level_up_results.clear();
 	level_up_results.emplace_back((*_system->strings)["LEVEL_DING"]);
 
@@ -1472,6 +1525,7 @@ auto Sorcery::Character::level_up() -> void {
 // Level a character down (e.g. drain levels or give/increase negative levels_
 auto Sorcery::Character::level_down() -> void {
 
+	_bump_revision();
 	using enum Enums::Character::Ability;
 	if (_abilities.at(CURRENT_LEVEL) == 1) {
 		_status = Enums::Character::Status::LOST;
@@ -1522,12 +1576,13 @@ auto Sorcery::Character::_try_learn_spell(Enums::Magic::SpellType spell_type,
 			return false;
 
 	// Get all unknown spells of this spell level and type
-	for (auto spells{_spells | std::views::filter([&](Spell spell) {
+	for (auto spells{_resources->spells->get_all() |
+					 std::views::filter([&](const Spell &spell) {
 						 return (spell.type == spell_type) &&
 								(spell.level == spell_level) &&
-								(spell.known == false);
+								!knows_spell(spell.id);
 					 })};
-		 auto &spell : spells) {
+		 const auto &spell : spells) {
 
 		const auto dice{(*_system->random)[Enums::System::Random::ZERO_TO_29]};
 
@@ -1536,15 +1591,13 @@ auto Sorcery::Character::_try_learn_spell(Enums::Magic::SpellType spell_type,
 		using enum Enums::Character::Attribute;
 		if (spell_type == DIVINE) {
 			if (dice <= static_cast<unsigned int>(_cur_attr[PIETY])) {
-				spell.known = true;
-				_spells_known[spell.id] = true;
+				_learn_spell(spell.id);
 				new_spell_learnt = true;
 			}
 		}
 		if (spell_type == ARCANE) {
 			if (dice <= static_cast<unsigned int>(_cur_attr[IQ])) {
-				spell.known = true;
-				_spells_known[spell.id] = true;
+				_learn_spell(spell.id);
 				new_spell_learnt = true;
 			}
 		}
@@ -1558,7 +1611,7 @@ auto Sorcery::Character::_calculate_sp(Enums::Magic::SpellType spell_type,
 									   unsigned int level_mod,
 									   unsigned int level_offset) -> void {
 
-	std::map<unsigned int, unsigned int> *spells{
+	SpellPoints *spells{
 		spell_type == Enums::Magic::SpellType::DIVINE ? &_priest_max_sp
 													  : &_mage_max_sp};
 	for (auto spell_level = 1; spell_level <= 7; spell_level++)
@@ -1770,14 +1823,33 @@ auto Sorcery::Character::_set_sp() -> bool {
 
 // In the original code this is from SPLPERLV
 auto Sorcery::Character::_get_spells_known(Enums::Magic::SpellType spell_type,
-										   unsigned int spell_level)
+										   unsigned int spell_level) const
 	-> unsigned int {
 
-	return std::ranges::count_if(
-		_spells.begin(), _spells.end(), [&](auto spell) {
-			return spell.type == spell_type && spell.level == spell_level &&
-				   spell.known;
-		});
+	return static_cast<unsigned int>(
+		(_spells_known & _resources->spells->get_mask(spell_type, spell_level))
+			.count());
+}
+
+// Known spells are saved in the same form as they always have been
+auto Sorcery::Character::_get_spells_known_map() const
+	-> EnumMap<Enums::Magic::SpellID, bool> {
+
+	EnumMap<Enums::Magic::SpellID, bool> spells_known;
+	for (auto i = 0u; i < NUM_SPELLS; i++)
+		spells_known[static_cast<Enums::Magic::SpellID>(i)] =
+			_spells_known.test(i);
+
+	return spells_known;
+}
+
+auto Sorcery::Character::_set_spells_known_map(
+	const EnumMap<Enums::Magic::SpellID, bool> &spells_known) -> void {
+
+	_spells_known.reset();
+	for (const auto &[spell_id, known] : spells_known)
+		if (known)
+			_learn_spell(spell_id);
 }
 
 // Given a level, get the XP needed for it
@@ -1820,39 +1892,44 @@ auto Sorcery::Character::_get_xp_for_level(unsigned int level) const -> int {
 	return xp_needed;
 }
 
-auto Sorcery::Character::set_spells() -> void {
-
-	// Now for each spell known set the appropriate entry in the spells table
-	for (auto &spell_known : _spells_known) {
+auto Sorcery::Character::replenish_spells() -> void {
 
-		std::vector<Spell>::iterator it;
-		it = std::find_if(_spells.begin(), _spells.end(), [&](auto item) {
-			return item.id == spell_known.first;
-		});
-		if (it != _spells.end())
-			(*it).known = spell_known.second;
+	_bump_revision();
+	for (auto level = 1; level <= 7; level++) {
+		_mage_cur_sp[level] = _mage_max_sp[level];
+		_priest_cur_sp[level] = _priest_max_sp[level];
 	}
 }
 
-// Wizardry 1 - 3 Spells
-auto Sorcery::Character::create_spells() -> void {
-
-	_spells.clear();
-	_spells = _resources->spells->get_all();
-}
+// Stay at the Inn for up to max_weeks, each week healing hp_per_week (but never
+// above maximum) for weekly_cost gold and ageing a week, stopping once healed
+// or out of gold; returns the number of weeks actually spent
+auto Sorcery::Character::recuperate(const unsigned int weekly_cost,
+									const unsigned int hp_per_week,
+									const unsigned int max_weeks)
+	-> unsigned int {
 
-auto Sorcery::Character::reset_spells() -> void {
+	_bump_revision();
+	const auto current_hp{get_current_hp()};
+	const auto max_hp{get_max_hp()};
+	if (current_hp >= max_hp || hp_per_week == 0)
+		return 0;
 
-	for (auto &spell : _spells)
-		_spells_known[spell.id] = spell.known;
-}
+	const auto hp_needed{static_cast<unsigned int>(max_hp - current_hp)};
+	const auto gold{get_gold()};
+	auto weeks{(hp_needed + hp_per_week - 1) / hp_per_week};
+	if (weekly_cost > 0)
+		weeks = std::min(weeks, gold / weekly_cost);
+	weeks = std::min(weeks, max_weeks);
+	if (weeks == 0)
+		return 0;
 
-auto Sorcery::Character::replenish_spells() -> void {
+	set_current_hp(
+		std::min(max_hp, current_hp + static_cast<int>(weeks * hp_per_week)));
+	set_gold(gold - (weeks * weekly_cost));
+	set_age(static_cast<int>(weeks));
 
-	for (auto level = 1; level <= 7; level++) {
-		_mage_cur_sp[level] = _mage_max_sp[level];
-		_priest_cur_sp[level] = _priest_max_sp[level];
-	}
+	return weeks;
 }
 
 // Given an Alignment and a Class, create a character
@@ -1860,6 +1937,7 @@ auto Sorcery::Character::create_class_alignment(
 	const Enums::Character::Class cclass,
 	const Enums::Character::Align alignment) -> void {
 
+	_bump_revision();
 	_class = cclass;
 	_race = static_cast<Enums::Character::Race>(
 		(*_system->random)[Enums::System::Random::D5]);
@@ -1942,6 +2020,7 @@ auto Sorcery::Character::create_class_alignment(
 // Enter Name and Portrait, rest is random
 auto Sorcery::Character::create_quick() -> void {
 
+	_bump_revision();
 	// Exclude Samurai/Lord/Ninja/Bishop from this method of character creation
 	using enum Enums::System::Random;
 	_class = static_cast<Enums::Character::Class>((*_system->random)[D4]);
@@ -2035,6 +2114,7 @@ auto Sorcery::Character::create_quick() -> void {
 // Create a (semi) random character
 auto Sorcery::Character::create_random() -> void {
 
+	_bump_revision();
 	// Random Name and Portrait
 	create_quick();
 	_name = _system->random->get_random_name();
@@ -2136,6 +2216,7 @@ auto Sorcery::Character::get_status_string() const -> std::string {
 
 auto Sorcery::Character::set_status(Enums::Character::Status value) -> void {
 
+	_bump_revision();
 	if (value == Enums::Character::Status::OK)
 		_status = value;
 	else {
@@ -2148,6 +2229,7 @@ auto Sorcery::Character::set_status(Enums::Character::Status value) -> void {
 
 auto Sorcery::Character::set_current_hp(const int hp) -> void {
 
+	_bump_revision();
 	_abilities[Enums::Character::Ability::CURRENT_HP] = hp;
 }
 
@@ -2184,16 +2266,19 @@ auto Sorcery::Character::get_hp_adjustment_symbol() const -> char {
 
 auto Sorcery::Character::set_hp_gain_per_turn(const int adjustment) -> void {
 
+	_bump_revision();
 	_abilities.at(Enums::Character::Ability::HP_GAIN_PER_TURN) = adjustment;
 }
 
 auto Sorcery::Character::set_hp_loss_per_turn(const int adjustment) -> void {
 
+	_bump_revision();
 	_abilities.at(Enums::Character::Ability::HP_LOSS_PER_TURN) = adjustment;
 }
 
 auto Sorcery::Character::reset_adjustment_per_turn() -> void {
 
+	_bump_revision();
 	using enum Enums::Character::Ability;
 	_abilities.at(HP_GAIN_PER_TURN) = 0;
 	_abilities.at(HP_LOSS_PER_TURN) = 0;
@@ -2201,6 +2286,7 @@ auto Sorcery::Character::reset_adjustment_per_turn() -> void {
 
 auto Sorcery::Character::set_poisoned_rate(int value) -> void {
 
+	_bump_revision();
 	using enum Enums::Character::Ability;
 	if (value > _abilities.at(POISON_STRENGTH)) {
 		_abilities.at(POISON_STRENGTH) = value;
@@ -2235,7 +2321,7 @@ auto Sorcery::Character::get_hp_summary() const -> std::string {
 auto Sorcery::Character::get_spell_points(
 	const Enums::Magic::SpellType type,
 	const Enums::Magic::SpellPointType status) const
-	-> std::optional<std::map<unsigned int, unsigned int>> {
+	-> std::optional<SpellPoints> {
 
 	using enum Enums::Magic::SpellPointType;
 	using enum Enums::Magic::SpellType;
@@ -2380,6 +2466,7 @@ auto Sorcery::Character::get_age() const -> int {
 
 auto Sorcery::Character::set_age(const int adjustment) -> void {
 
+	_bump_revision();
 	_abilities.at(Enums::Character::Ability::AGE) =
 		_abilities.at(Enums::Character::Ability::AGE) + adjustment;
 }
@@ -2439,11 +2526,13 @@ auto Sorcery::Character::summary_text() -> std::string {
 
 auto Sorcery::Character::damage(const unsigned int adjustment) -> bool {
 
+	_bump_revision();
 	return _damage(adjustment);
 }
 
 auto Sorcery::Character::heal(const unsigned int adjustment) -> void {
 
+	_bump_revision();
 	_heal(adjustment);
 }
 
@@ -2475,6 +2564,7 @@ auto Sorcery::Character::get_method() const -> Enums::Manage::Method {
 
 auto Sorcery::Character::set_method(const Enums::Manage::Method value) -> void {
 
+	_bump_revision();
 	_method = value;
 }
 
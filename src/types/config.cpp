@@ -43,7 +43,7 @@ auto Sorcery::Config::get(std::string_view section,
 
 	// Get a value from the config file
 	return _settings->GetValue(CSTR(std::string{section}),
-							   CSTR(std::string{value}));
+							   CSTR(std::string{value}), "");
 }
 
 bool Sorcery::Config::has_changed() {
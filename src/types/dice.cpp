@@ -108,3 +108,9 @@ auto Sorcery::Dice::set(const unsigned int num_, const unsigned int dice_,
 	dice = dice_;
 	mod = mod_;
 }
+
+// Only for repeatable runs (see Random::seed)
+auto Sorcery::Dice::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
@@ -22,6 +22,7 @@
 
 #include "types/game.hpp"
 #include "common/macro.hpp"
+#include "core/profiler.hpp"
 #include "core/resources.hpp"
 #include "core/system.hpp"
 #include "types/state.hpp"
@@ -53,6 +54,7 @@ auto Sorcery::Game::_set_up_debug_keys() -> void {
 	_debug[SDLK_F6] = std::bind(&Game::_debug_give_party_gold, this);
 	_debug[SDLK_F7] = std::bind(&Game::_debug_give_party_xp, this);
 	_debug[SDLK_F8] = std::bind(&Game::_debug_give_party_random_items, this);
+	_debug[SDLK_F9] = std::bind(&Game::toggle_console, this);
 }
 
 // Call the Debug Function associated with the Key Press (if any)
@@ -82,140 +84,36 @@ auto Sorcery::Game::move_party_to_tavern() -> void {
 	state->clear_party();
 }
 
-// Mappings for each type of special dungeon event in the Proving Grounds
+// The (per game) state of each type of special dungeon event in the Proving
+// Grounds, with the fixed details coming from the shared EVENTS table
 auto Sorcery::Game::_set_up_dungeon_events() -> void {
-	_events.clear();
-
-	// bool params are:
-	//
-	// search after
-	// encounter after
-	// go back a square after
-	// teleport back to town
-
-	// Level 1
-	using enum Enums::Map::Event;
-	_events.emplace_back(AREA_OF_OUT_BOUNDS, "event_area_out_of_bounds", false,
-						 false, false, false);
-	_events.emplace_back(MAN_TELEPORT_CASTLE, "event_man_teleport_castle",
-						 false, false, false, true);
-	_events.emplace_back(SILVER_KEY, "event_silver_key", true, false, false,
-						 false);
-	_events.emplace_back(BRONZE_KEY, "event_bronze_key", true, false, false,
-						 false);
-	_events.emplace_back(MURPHYS_GHOSTS, "event_murphys_ghosts", true, true,
-						 false, false);
-
-	// Level 2
-	_events.emplace_back(GOLD_KEY, "event_gold_key", true, false, false, false);
-	_events.emplace_back(BEAR_STATUE, "event_bear_statue", true, false, false,
-						 false);
-	_events.emplace_back(FROG_STATUE, "event_frog_statue", true, false, false,
-						 false);
-	_events.emplace_back(PLACARD_PIT_1, "event_placard_pit_1", false, false,
-						 false, false);
-	_events.emplace_back(PLACARD_PIT_2, "event_placard_pit_2", false, false,
-						 false, false);
-	_events.emplace_back(PLACARD_PIT_3, "event_placard_pit_3", false, false,
-						 false, false);
-	_events.emplace_back(NEED_SILVER_KEY, "event_need_silver_key", false, false,
-						 true, false);
-	_events.emplace_back(NEED_BRONZE_KEY, "event_need_bronze_key", false, false,
-						 true, false);
-	_events.emplace_back(NEED_BEAR_STATUE, "event_cannot_break_doors_down",
-						 false, false, true, false);
-	_events.emplace_back(NEED_FROG_STATUE, "event_cannot_break_doors_down",
-						 false, false, true, false);
-
-	// Level 3
-	_events.emplace_back(TURN_LEFT, "event_turn_left", false, false, false,
-						 false);
-	_events.emplace_back(TURN_AROUND, "event_turn_around", false, false, false,
-						 false);
-	_events.emplace_back(TURN_RIGHT, "event_turn_right", false, false, false,
-						 false);
-
-	// Level 4
-	_events.emplace_back(NEED_BEAR_STATUE_2, "event_need_bear_statue_2", false,
-						 false, true, false);
-	_events.emplace_back(TESTING_GROUNDS, "event_testing_grounds", false, false,
-						 false, false);
-	_events.emplace_back(ALARM_BELLS, "event_alarm_bells", false, true, false,
-						 false);
-	_events.emplace_back(TREASURE_REPOSITORY, "event_treasure_repository",
-						 false, false, false, false);
-	_events.emplace_back(MONSTER_ALLOCATION_CENTRE,
-						 "event_monster_allocation_centre", false, false, false,
-						 false);
-	_events.emplace_back(NEED_BLUE_RIBBON, "event_need_blue_ribbon", false,
-						 false, true, false);
-	_events.emplace_back(SERVICE_ELEVATOR, "event_service_elevator", false,
-						 false, false, false);
-	_events.emplace_back(GUARANTEED_COMBAT, "event_guaranteed_combat", false,
-						 true, false, false);
-	_events.emplace_back(LARGE_DESK, "event_large_desk", false, false, false,
-						 false);
-	_events.emplace_back(DEADLY_RING_COMBAT, "event_deadly_ring_combat", false,
-						 true, false, false);
-	_events.emplace_back(TREBOR_VOICE, "event_trebor_voice", false, false,
-						 false, false);
-
-	// Level 6
-	_events.emplace_back(THREE_HUMANOIDS, "event_three_humanoids", false, false,
-						 false, false);
-
-	// Level 7
-	_events.emplace_back(GETTING_WARM_1, "event_getting_warm_1", false, false,
-						 false, false);
-	_events.emplace_back(GETTING_WARM_2, "event_getting_warm_2", false, false,
-						 false, false);
-	_events.emplace_back(GETTING_WARM_3, "event_getting_warm_3", false, false,
-						 false, false);
-	_events.emplace_back(FIRE_DRAGONS_COMBAT, "event_fire_dragons_combat",
-						 false, true, false, false);
-
-	// Level 10
-	_events.emplace_back(WERDNA_BOAST, "event_werdna_boast", false, false,
-						 false, false);
-	_events.emplace_back(TURN_BACK, "event_turn_back", false, false, false,
-						 false);
-	_events.emplace_back(WERDNA_SIGN, "event_werdna_sign_1", false, false,
-						 false, false);
+
+	for (const auto &descriptor : EVENTS)
+		_events.at(unenum(descriptor.event)) =
+			DungeonEvent{descriptor.event,		   descriptor.component_key,
+						 descriptor.search_after,  descriptor.combat_after,
+						 descriptor.go_back_after, descriptor.go_town_after};
 }
 
+// Always assumes that event_type isn't NO_EVENT
 auto Sorcery::Game::get_event(Enums::Map::Event event_type) const
-	-> DungeonEvent {
-
-	auto it{std::ranges::find_if(_events.begin(), _events.end(),
-								 [&](const auto &dungeon_event) {
-									 return (dungeon_event.event == event_type);
-								 })};
+	-> const DungeonEvent & {
 
-	return *it;
+	return _events.at(unenum(event_type));
 
 	// TODO: handle updating of these
 }
 
 auto Sorcery::Game::enable_event(Enums::Map::Event event_type) -> void {
 
-	auto it{std::ranges::find_if(_events.begin(), _events.end(),
-								 [&](const auto &dungeon_event) {
-									 return (dungeon_event.event == event_type);
-								 })};
-
-	if (it != _events.end())
-		(*it).enabled = true;
+	if (event_type != Enums::Map::Event::NO_EVENT)
+		_events.at(unenum(event_type)).enabled = true;
 }
 
 auto Sorcery::Game::disable_event(Enums::Map::Event event_type) -> void {
 
-	auto it{std::ranges::find_if(_events.begin(), _events.end(),
-								 [&](const auto &dungeon_event) {
-									 return (dungeon_event.event == event_type);
-								 })};
-
-	if (it != _events.end())
-		(*it).enabled = false;
+	if (event_type != Enums::Map::Event::NO_EVENT)
+		_events.at(unenum(event_type)).enabled = false;
 }
 
 auto Sorcery::Game::get_id() const -> unsigned int {
@@ -235,6 +133,8 @@ auto Sorcery::Game::load_game() -> void {
 
 auto Sorcery::Game::save_game() -> void {
 
+	PROFILE_SCOPE("Game::save_game");
+
 	_save_game();
 }
 
@@ -253,14 +153,13 @@ auto Sorcery::Game::restart_maze(unsigned int char_id) -> void {
 	const auto to_depth{character.depth.value()};
 	const auto to_loc{character.coordinate.value()};
 	state->clear_party();
-	for (auto &[id, character] : characters) {
-		if (character.get_location() == Enums::Character::Location::MAZE) {
-			if (character.depth.value() == to_depth &&
-				character.coordinate.value() == to_loc) {
-				character.set_location(Enums::Character::Location::PARTY);
-				state->add_character_by_id(id);
-			}
-		}
+
+	// Copy since moving characters into the party removes them from the index
+	const auto at_loc{get_characters_at(to_depth, to_loc)};
+	for (const std::vector<unsigned int> ids{at_loc.begin(), at_loc.end()};
+		 const auto id : ids) {
+		set_character_location(id, Enums::Character::Location::PARTY);
+		state->add_character_by_id(id);
 	}
 
 	state->set_depth(to_depth);
@@ -272,6 +171,7 @@ auto Sorcery::Game::restart_maze(unsigned int char_id) -> void {
 
 auto Sorcery::Game::delete_character(unsigned int char_id) -> void {
 
+	_unindex_character(char_id);
 	_system->db->delete_character(_id, char_id);
 }
 
@@ -384,9 +284,10 @@ auto Sorcery::Game::_save_game() -> void {
 }
 
 auto Sorcery::Game::_save_characters() -> void {
+
+	_update_party_location();
 	for (const auto &[char_id, character] : characters) {
 
-		_update_party_location();
 		std::stringstream ss;
 		{
 			cereal::XMLOutputArchive out_archive(ss);
@@ -401,40 +302,106 @@ auto Sorcery::Game::_save_characters() -> void {
 
 auto Sorcery::Game::has_party_in_maze() const -> bool {
 
-	for (auto &[char_id, character] : characters) {
+	return !_in_maze.empty();
+}
 
-		if (character.get_location() == Enums::Character::Location::MAZE)
-			return true;
+// Party members aren't in the maze index, so only need their position updating
+auto Sorcery::Game::_update_party_location() -> void {
+
+	for (const auto char_id : state->get_party_characters()) {
+		auto &character{characters.at(char_id)};
+		character.depth = state->get_depth();
+		character.coordinate = state->get_player_pos();
 	}
+}
+
+// Characters (or their bodies) on the square the party is currently on
+auto Sorcery::Game::get_characters_at_loc() const
+	-> std::span<const unsigned int> {
 
-	return false;
+	return get_characters_at(state->get_depth(), state->get_player_pos());
 }
 
-auto Sorcery::Game::_update_party_location() -> void {
+auto Sorcery::Game::get_characters_at(const int depth,
+									  const Coordinate loc) const
+	-> std::span<const unsigned int> {
 
-	auto party{state->get_party_characters()};
-	for (auto &[char_id, character] : characters) {
-		if (std::find(party.begin(), party.end(), char_id) != party.end()) {
-			character.depth = state->get_depth();
-			character.coordinate = state->get_player_pos();
-		}
-	}
+	if (const auto level{_in_maze.find(depth)}; level != _in_maze.end())
+		if (const auto square{level->second.find(loc)};
+			square != level->second.end())
+			return square->second;
+
+	return {};
 }
 
-auto Sorcery::Game::get_characters_at_loc() const -> std::vector<unsigned int> {
+auto Sorcery::Game::get_characters_on_level(const int depth) const
+	-> std::vector<unsigned int> {
 
 	std::vector<unsigned int> results;
-	for (auto &[char_id, character] : characters) {
-		if (character.get_location() == Enums::Character::Location::MAZE) {
-			if (character.coordinate == state->get_player_pos()) {
-				results.emplace_back(char_id);
-			}
-		}
-	}
+	if (const auto level{_in_maze.find(depth)}; level != _in_maze.end())
+		for (const auto &[loc, ids] : level->second)
+			results.insert(results.end(), ids.begin(), ids.end());
 
 	return results;
 }
 
+// Use this rather than Character::set_location so that the index of characters
+// left in the maze is kept up to date
+auto Sorcery::Game::set_character_location(
+	const unsigned int char_id, const Enums::Character::Location location)
+	-> void {
+
+	// Anyone leaving the party in the maze stays where the party is now
+	if (location == Enums::Character::Location::MAZE)
+		_update_party_location();
+
+	_unindex_character(char_id);
+	characters.at(char_id).set_location(location);
+	_index_character(char_id);
+}
+
+auto Sorcery::Game::_index_characters() -> void {
+
+	_in_maze.clear();
+	for (const auto &[char_id, character] : characters)
+		_index_character(char_id);
+}
+
+auto Sorcery::Game::_index_character(const unsigned int char_id) -> void {
+
+	const auto &character{characters.at(char_id)};
+	if (character.get_location() != Enums::Character::Location::MAZE ||
+		!character.depth || !character.coordinate)
+		return;
+
+	_in_maze[character.depth.value()][character.coordinate.value()].push_back(
+		char_id);
+}
+
+auto Sorcery::Game::_unindex_character(const unsigned int char_id) -> void {
+
+	const auto it{characters.find(char_id)};
+	if (it == characters.end())
+		return;
+
+	const auto &character{it->second};
+	if (!character.depth || !character.coordinate)
+		return;
+
+	const auto level{_in_maze.find(character.depth.value())};
+	if (level == _in_maze.end())
+		return;
+	const auto square{level->second.find(character.coordinate.value())};
+	if (square == level->second.end())
+		return;
+
+	std::erase(square->second, char_id);
+	if (square->second.empty())
+		level->second.erase(square);
+	if (level->second.empty())
+		_in_maze.erase(level);
+}
+
 auto Sorcery::Game::save_character(Character character) -> unsigned int {
 
 	std::stringstream ss;
@@ -478,10 +445,10 @@ auto Sorcery::Game::_load_characters() -> void {
 			cereal::XMLInputArchive in_archive(ss);
 			in_archive(character);
 		}
-		character.create_spells();
-		character.set_spells();
 		characters[char_id] = character;
 	}
+
+	_index_characters();
 }
 
 auto Sorcery::Game::get_party_alignment() const -> Enums::Character::Align {
@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "types/gamelog.hpp"
+#include "common/macro.hpp"
+
+Sorcery::GameLog::GameLog(const std::size_t capacity)
+	: _entries(std::max<std::size_t>(capacity, 1)),
+	  _head{0},
+	  _size{0},
+	  _next_id{0} {}
+
+// Messages are indexed from the oldest (0) to the newest (size() - 1)
+auto Sorcery::GameLog::operator[](const std::size_t index) const
+	-> const Entry & {
+
+	return _entries[(_head + index) % _entries.size()];
+}
+
+auto Sorcery::GameLog::add(const Enums::Internal::MessageType type,
+						   std::string_view text) -> void {
+
+	_add(type, std::chrono::system_clock::now(), text);
+}
+
+// Used when restoring the log from a saved game
+auto Sorcery::GameLog::add(const ConsoleMessage &message) -> void {
+
+	_add(message.type, message.datetime, message.text);
+}
+
+auto Sorcery::GameLog::clear() -> void {
+
+	_head = 0;
+	_size = 0;
+}
+
+auto Sorcery::GameLog::empty() const -> bool {
+
+	return _size == 0;
+}
+
+auto Sorcery::GameLog::size() const -> std::size_t {
+
+	return _size;
+}
+
+// Only the most recent messages are kept in saved games
+auto Sorcery::GameLog::get_last(std::size_t count) const
+	-> std::vector<ConsoleMessage> {
+
+	count = std::min(count, _size);
+	std::vector<ConsoleMessage> messages;
+	messages.reserve(count);
+	for (auto i = _size - count; i < _size; i++) {
+		const auto &entry{(*this)[i]};
+		messages.emplace_back(entry.type, entry.datetime, entry.text);
+	}
+
+	return messages;
+}
+
+auto Sorcery::GameLog::set_spill_file(const std::filesystem::path &path)
+	-> void {
+
+	if (_spill.is_open())
+		_spill.close();
+	if (!path.empty())
+		_spill.open(path, std::ios::out | std::ios::app);
+}
+
+auto Sorcery::GameLog::_add(
+	const Enums::Internal::MessageType type,
+	const std::chrono::time_point<std::chrono::system_clock> tp,
+	std::string_view text) -> void {
+
+	auto &entry{std::invoke([&]() -> Entry & {
+		if (_size < _entries.size())
+			return _entries[(_head + _size++) % _entries.size()];
+
+		// Full, so the oldest message makes way
+		auto &oldest{_entries[_head]};
+		_head = (_head + 1) % _entries.size();
+		if (_spill.is_open())
+			_spill << oldest.line << '\n';
+		return oldest;
+	})};
+
+	entry.id = _next_id++;
+	entry.type = type;
+	entry.datetime = tp;
+	entry.text.assign(text);
+	entry.line.clear();
+	std::format_to(std::back_inserter(entry.line), "[{}: {}]", TP2STR(tp),
+				   text);
+}
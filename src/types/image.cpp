@@ -26,16 +26,34 @@ Sorcery::Image::Image()
 	: key{""},
 	  texture{0},
 	  width{0},
-	  height{0} {};
+	  height{0},
+	  uv_min{0.0f, 0.0f},
+	  uv_max{1.0f, 1.0f},
+	  atlased{false},
+	  resident{false},
+	  bytes{0},
+	  last_frame{0} {};
 
 Sorcery::Image::Image(std::string key_, GLuint texture_, int width_,
 					  int height_)
 	: key{key_},
 	  texture{texture_},
 	  width{width_},
-	  height{height_} {};
+	  height{height_},
+	  uv_min{0.0f, 0.0f},
+	  uv_max{1.0f, 1.0f},
+	  atlased{false},
+	  resident{false},
+	  bytes{0},
+	  last_frame{0} {};
 
 auto Sorcery::Image::operator<=>(const Image &a) const {
 
 	return key <=> a.key;
-}
\ No newline at end of file
+}
+// Convert a 0-1 coordinate within the image into one within its texture
+auto Sorcery::Image::uv(const ImVec2 local) const -> ImVec2 {
+
+	return ImVec2{uv_min.x + (local.x * (uv_max.x - uv_min.x)),
+				  uv_min.y + (local.y * (uv_max.y - uv_min.y))};
+}
@@ -26,103 +26,122 @@
 #include "core/system.hpp"
 #include "types/itemtype.hpp"
 
-Sorcery::Inventory::Inventory() {
-
-	_items.clear();
-}
+Sorcery::Inventory::Inventory()
+	: _items{},
+	  _count{0},
+	  _revision{++s_revision} {}
 
 auto Sorcery::Inventory::operator[](const unsigned int slot)
 	-> std::optional<Item *> {
 
-	if (_items.size() >= (slot - 1))
-		return &_items.at(slot - 1);
+	_bump_revision();
+	if (_valid(slot))
+		return &_items[slot - 1];
 	else
 		return std::nullopt;
 }
 
-auto Sorcery::Inventory::get(const unsigned int slot) -> Item {
+auto Sorcery::Inventory::get(const unsigned int slot) const -> const Item & {
 
 	return _items.at(slot - 1);
 }
 
 auto Sorcery::Inventory::has(const unsigned int slot) const -> bool {
 
-	return _items.size() >= (slot - 1);
+	return _valid(slot);
 }
 
-auto Sorcery::Inventory::items() const -> std::vector<Item> {
+auto Sorcery::Inventory::items() const -> std::span<const Item> {
 
-	return _items;
+	return std::span<const Item>{_items.data(), _count};
 }
 
 auto Sorcery::Inventory::clear() -> void {
 
-	_items.clear();
+	_bump_revision();
+	_count = 0;
 }
 
 auto Sorcery::Inventory::size() const -> unsigned int {
 
-	return _items.size();
+	return _count;
 }
 
 auto Sorcery::Inventory::is_full() const -> bool {
 
-	return _items.size() == 8;
+	return _count == INVENTORY_SIZE;
+}
+
+// Any change to the items, or a mutable item being handed out, changes this
+auto Sorcery::Inventory::get_revision() const -> unsigned int {
+
+	return _revision;
+}
+
+auto Sorcery::Inventory::_bump_revision() -> void {
+
+	_revision = ++s_revision;
 }
 
 auto Sorcery::Inventory::get_empty_slots() const -> unsigned int {
 
-	return 8 - _items.size();
+	return INVENTORY_SIZE - _count;
 }
 
 auto Sorcery::Inventory::is_empty() const -> bool {
 
-	return _items.size() == 8;
+	return _count == 0;
 }
 
 auto Sorcery::Inventory::add_type(const ItemType &item_type, const bool known)
 	-> bool {
 
-	if (_items.size() != 8) {
-		Item item{item_type};
-		item.set_known(known);
-		item.set_usable(true);
-		_items.emplace_back(item);
-		return true;
-	} else
-		return false;
+	return add_type(item_type, true, known);
 }
 
-auto Sorcery::Inventory::add(Item item) -> void {
+auto Sorcery::Inventory::add(const Item &item) -> bool {
+
+	_bump_revision();
+	if (is_full())
+		return false;
+
+	_items[_count++] = item;
 
-	_items.emplace_back(item);
+	return true;
 }
 
 auto Sorcery::Inventory::add_type(const ItemType &item_type, const bool usable,
 								  const bool known) -> bool {
 
-	if (_items.size() != 8) {
-		Item item{item_type};
-		item.set_known(known);
-		item.set_usable(usable);
-		_items.emplace_back(item);
-		return true;
-	} else
-		return false;
+	Item item{item_type, usable};
+	item.set_known(known);
+
+	return add(item);
 }
 
 auto Sorcery::Inventory::add_type(const ItemType &item_type) -> bool {
 
-	if (_items.size() != 8) {
-		_items.emplace_back(item_type);
-		return true;
-	} else
-		return false;
+	return add(Item{item_type});
+}
+
+auto Sorcery::Inventory::_valid(const unsigned int slot) const -> bool {
+
+	return slot > 0 && slot <= _count;
+}
+
+// Close the gap left by a removed item so the slots stay contiguous
+auto Sorcery::Inventory::_erase(const unsigned int slot) -> void {
+
+	_bump_revision();
+	std::copy(_items.begin() + slot, _items.begin() + _count,
+			  _items.begin() + (slot - 1));
+	--_count;
 }
 
 auto Sorcery::Inventory::unequip_all() -> void {
 
-	for (auto &item : _items) {
+	_bump_revision();
+	for (auto &item : std::span{_items.data(), _count}) {
 		if (item.get_equipped())
 			item.set_equipped(false);
 	}
@@ -130,26 +149,24 @@ auto Sorcery::Inventory::unequip_all() -> void {
 
 auto Sorcery::Inventory::has_unidentified_items() const -> bool {
 
-	return std::ranges::any_of(_items.begin(), _items.end(),
-							   [&](const auto &item) {
-								   return item.get_known() == false;
-							   });
+	return std::ranges::any_of(items(), [&](const auto &item) {
+		return item.get_known() == false;
+	});
 }
 
 auto Sorcery::Inventory::has_cursed_items() const -> bool {
 
-	return std::ranges::any_of(_items.begin(), _items.end(),
-							   [&](const auto &item) {
-								   return item.get_cursed() == false;
-							   });
+	return std::ranges::any_of(items(), [&](const auto &item) {
+		return item.get_cursed() == false;
+	});
 }
 
 auto Sorcery::Inventory::is_equipped_cursed(const unsigned int slot) -> bool {
 
-	if (_items.size() < (slot - 1))
+	if (!_valid(slot))
 		return false;
 
-	const auto candidate{_items.at(slot - 1)};
+	const auto &candidate{_items[slot - 1]};
 
 	return candidate.get_cursed() && candidate.get_equipped();
 }
@@ -157,7 +174,7 @@ auto Sorcery::Inventory::is_equipped_cursed(const unsigned int slot) -> bool {
 auto Sorcery::Inventory::_unequip_item_category(
 	const Enums::Items::Category category) -> bool {
 
-	for (auto &item : _items) {
+	for (auto &item : std::span{_items.data(), _count}) {
 		if (item.get_equipped() && item.get_category() == category) {
 			item.set_equipped(false);
 			return true;
@@ -174,14 +191,15 @@ auto Sorcery::Inventory::identify_item(const unsigned int slot,
 									   const unsigned int curse_chance)
 	-> Enums::Items::IdentifyOutcome {
 
+	_bump_revision();
 	auto cursed{false};
 	auto success{false};
 
 	using enum Enums::Items::IdentifyOutcome;
-	if (_items.size() < (slot - 1))
+	if (!_valid(slot))
 		return NONE;
 
-	auto &candidate{_items.at(slot - 1)};
+	auto &candidate{_items[slot - 1]};
 	if (roll < id_chance) {
 		success = true;
 		candidate.set_known(true);
@@ -205,10 +223,11 @@ auto Sorcery::Inventory::identify_item(const unsigned int slot,
 
 auto Sorcery::Inventory::equip_item(const unsigned int slot) -> bool {
 
-	if (_items.size() < (slot - 1))
+	_bump_revision();
+	if (!_valid(slot))
 		return false;
 
-	auto &candidate{_items.at(slot - 1)};
+	auto &candidate{_items[slot - 1]};
 	const auto item_category{candidate.get_category()};
 
 	if (!candidate.get_usable())
@@ -217,7 +236,7 @@ auto Sorcery::Inventory::equip_item(const unsigned int slot) -> bool {
 	if (_has_cursed_equipped_item_category(item_category))
 		return false;
 
-	for (auto &item : _items) {
+	for (auto &item : std::span{_items.data(), _count}) {
 
 		if (item.get_category() == item_category && item.get_equipped())
 			item.set_equipped(false);
@@ -230,27 +249,25 @@ auto Sorcery::Inventory::equip_item(const unsigned int slot) -> bool {
 
 auto Sorcery::Inventory::drop_item(const unsigned int slot) -> bool {
 
-	if (_items.size() < (slot - 1))
+	if (!_valid(slot))
 		return false;
 
-	auto candidate{_items.at(slot - 1)};
-	if (candidate.get_equipped())
+	if (_items[slot - 1].get_equipped())
 		return false;
-	candidate.set_known(true);
 
 	// For now, just discard the item
-	_items.erase(_items.begin() + (slot - 1));
+	_erase(slot);
 
 	return true;
 }
 
 auto Sorcery::Inventory::discard_item(const unsigned int slot) -> bool {
 
-	if (_items.size() < (slot - 1))
+	if (!_valid(slot))
 		return false;
 
 	// For now, just discard the item
-	_items.erase(_items.begin() + (slot - 1));
+	_erase(slot);
 
 	return true;
 }
@@ -258,10 +275,9 @@ auto Sorcery::Inventory::discard_item(const unsigned int slot) -> bool {
 auto Sorcery::Inventory::_has_equipped_item_category(
 	const Enums::Items::Category category) const -> bool {
 
-	return std::ranges::any_of(
-		_items.begin(), _items.end(), [&](const auto &item) {
-			return item.get_category() == category && item.get_equipped();
-		});
+	return std::ranges::any_of(items(), [&](const auto &item) {
+		return item.get_category() == category && item.get_equipped();
+	});
 }
 
 auto Sorcery::Inventory::has_cursed_equipped_item_category(
@@ -273,11 +289,10 @@ auto Sorcery::Inventory::has_cursed_equipped_item_category(
 auto Sorcery::Inventory::_has_cursed_equipped_item_category(
 	const Enums::Items::Category category) const -> bool {
 
-	return std::ranges::any_of(
-		_items.begin(), _items.end(), [&](const auto &item) {
-			return item.get_category() == category && item.get_equipped() &&
-				   item.get_cursed();
-		});
+	return std::ranges::any_of(items(), [&](const auto &item) {
+		return item.get_category() == category && item.get_equipped() &&
+			   item.get_cursed();
+	});
 }
 
 namespace Sorcery {
@@ -288,7 +303,7 @@ auto operator<<(std::ostream &out_stream, const Sorcery::Inventory &inventory)
 	auto body{"Inventory:\n\n"s};
 	int slot{1};
 
-	for (const auto &item : inventory._items) {
+	for (const auto &item : inventory.items()) {
 		const std::string flag{std::invoke([&] {
 			if (!item.get_known())
 				return "?";
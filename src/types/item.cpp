@@ -22,67 +22,94 @@
 
 #include "types/item.hpp"
 #include "common/macro.hpp"
+#include "common/types.hpp"
+#include "types/define.hpp"
 #include "types/itemtype.hpp"
+#include <deque>
+
+namespace {
+
+// Interned item names; entries are never removed, so references stay valid.
+// Items can be made on any thread, so adding a name takes the lock and reading
+// one (every frame, for inventories and panels) shares it. There is a limit
+// as custom names are never freed
+struct ItemNames {
+		std::shared_mutex mutex;
+		std::deque<std::string> names{""};
+		std::unordered_map<std::string, std::uint16_t, Sorcery::StringHash,
+						   std::equal_to<>>
+			ids{{"", 0}};
+};
+
+auto item_names() -> ItemNames & {
+
+	static ItemNames item_names{};
+
+	return item_names;
+}
+
+} // namespace
 
 // Default Constructor
-Sorcery::Item::Item() {
+Sorcery::Item::Item()
+	: _type{Enums::Items::TypeID::BROKEN_ITEM},
+	  _category{Enums::Items::Category::NO_ITEM_CATEGORY},
+	  _flags{USABLE},
+	  _name{0},
+	  _uname{0} {}
 
-	_type = Enums::Items::TypeID::BROKEN_ITEM;
-	_category = Enums::Items::Category::NO_ITEM_CATEGORY;
-	_known = false;
-	_equipped = false;
-	_cursed = false;
-	_marked = false;
-	_usable = true;
-	_name = "";
-	_uname = "";
+Sorcery::Item::Item(const ItemType &item_type, const bool usable)
+	: _type{item_type.get_type_id()},
+	  _category{item_type.get_category()},
+	  _flags{0},
+	  _name{_intern(item_type.get_known_name())},
+	  _uname{_intern(item_type.get_unknown_name())} {
 
-	_id = s_id++;
+	_set_flag(CURSED, item_type.get_cursed());
+	_set_flag(USABLE, usable);
 }
 
-Sorcery::Item::Item(const ItemType &item_type, const bool usable) {
+Sorcery::Item::Item(const ItemType &item_type) : Item(item_type, true) {}
+
+auto Sorcery::Item::_intern(std::string_view name) -> std::uint16_t {
+
+	auto &item_names{item_names()};
+	std::unique_lock<std::shared_mutex> unique_lock(item_names.mutex);
+	if (auto it{item_names.ids.find(name)}; it != item_names.ids.end())
+		return it->second;
 
-	_type = item_type.get_type_id();
-	_category = item_type.get_category();
+	if (item_names.names.size() >= ITEM_NAME_LIMIT)
+		throw std::length_error{
+			std::format("Too many item names to add '{}'!", name)};
 
-	_usable = usable;
-	_known = false;
-	_equipped = false;
-	_cursed = item_type.get_cursed();
-	_marked = false;
-	_name = item_type.get_known_name();
-	_uname = item_type.get_unknown_name();
+	const auto id{static_cast<std::uint16_t>(item_names.names.size())};
+	item_names.names.emplace_back(name);
+	item_names.ids.emplace(item_names.names.back(), id);
 
-	_id = s_id++;
+	return id;
 }
 
-Sorcery::Item::Item(const ItemType &item_type) {
+auto Sorcery::Item::_get_interned(const std::uint16_t id)
+	-> const std::string & {
 
-	_type = item_type.get_type_id();
-	_category = item_type.get_category();
+	auto &item_names{item_names()};
+	std::shared_lock<std::shared_mutex> shared_lock(item_names.mutex);
+
+	return item_names.names.at(id);
+}
 
-	_known = false;
-	_equipped = false;
-	_cursed = item_type.get_cursed();
-	_marked = false;
-	_usable = true;
-	_name = item_type.get_known_name();
-	_uname = item_type.get_unknown_name();
+auto Sorcery::Item::_get_flag(const std::uint8_t flag) const -> bool {
 
-	_id = s_id++;
+	return (_flags & flag) != 0;
 }
 
-Sorcery::Item::Item(const Item &item) {
+auto Sorcery::Item::_set_flag(const std::uint8_t flag, const bool value)
+	-> void {
 
-	_type = item._type;
-	_category = item._category;
-	_known = item._known;
-	_equipped = item._equipped;
-	_cursed = item._cursed;
-	_marked = item._marked;
-	_usable = item._usable;
-	_name = item._name;
-	_uname = item._uname;
+	if (value)
+		_flags |= flag;
+	else
+		_flags &= ~flag;
 }
 
 auto Sorcery::Item::get_type_id() const -> Enums::Items::TypeID {
@@ -97,67 +124,67 @@ auto Sorcery::Item::get_category() const -> Enums::Items::Category {
 
 auto Sorcery::Item::get_known() const -> bool {
 
-	return _known;
+	return _get_flag(KNOWN);
 }
 
 auto Sorcery::Item::set_usable(const bool value) -> void {
 
-	_usable = value;
+	_set_flag(USABLE, value);
 }
 
 auto Sorcery::Item::get_usable() const -> bool {
 
-	return _usable;
+	return _get_flag(USABLE);
 }
 
 auto Sorcery::Item::get_equipped() const -> bool {
 
-	return _equipped;
+	return _get_flag(EQUIPPED);
 }
 
 auto Sorcery::Item::get_cursed() const -> bool {
 
-	return _cursed;
+	return _get_flag(CURSED);
 }
 
 auto Sorcery::Item::get_marked() const -> bool {
 
-	return _marked;
+	return _get_flag(MARKED);
 }
 
-auto Sorcery::Item::get_name() const -> std::string {
+auto Sorcery::Item::get_name() const -> std::string_view {
 
-	return _name;
+	return _get_interned(_name);
 }
 
-auto Sorcery::Item::get_display_name() const -> std::string {
+auto Sorcery::Item::get_display_name() const -> std::string_view {
 
-	return _known ? _name : _uname;
+	return _get_interned(get_known() ? _name : _uname);
 }
 
 auto Sorcery::Item::set_known(const bool value) -> void {
 
-	_known = value;
+	_set_flag(KNOWN, value);
 }
 
 auto Sorcery::Item::set_equipped(const bool value) -> void {
 
-	_equipped = value;
+	_set_flag(EQUIPPED, value);
 }
 
 auto Sorcery::Item::set_cursed(const bool value) -> void {
 
-	_cursed = value;
+	_set_flag(CURSED, value);
 }
 
 auto Sorcery::Item::set_marked(const bool value) -> void {
 
-	_marked = value;
+	_set_flag(MARKED, value);
 }
 
-auto Sorcery::Item::set_name(const std::string &value) -> void {
+auto Sorcery::Item::set_name(std::string_view value) -> void {
 
-	_name = value;
+	_name = _intern(value);
 }
 
 auto Sorcery::Item::decay_to(const Enums::Items::TypeID value) -> void {
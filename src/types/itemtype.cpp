@@ -503,3 +503,9 @@ auto operator<<(std::ostream &out_stream, const Sorcery::ItemType &itemtype)
 	return out_stream << text << std::flush;
 }
 } // namespace Sorcery
+
+// Only for repeatable runs (see Random::seed)
+auto Sorcery::ItemType::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
@@ -22,6 +22,7 @@
 
 #include "types/level.hpp"
 #include "core/include.hpp"
+#include "types/event.hpp"
 
 // Default Constructor
 Sorcery::Level::Level() {
@@ -248,60 +249,6 @@ auto Sorcery::Level::_create() -> void {
 			_add_tile(Coordinate{x, y});
 		}
 	}
-
-	_add_event_mappings();
-}
-
-auto Sorcery::Level::_add_event_mappings() -> void {
-
-	using Enums::Map::Event;
-
-	_event_mappings.clear();
-
-	_event_mappings["AREA_OUT_OF_BOUNDS"] = Event::AREA_OF_OUT_BOUNDS;
-
-	_event_mappings["MAN_TELEPORT_CASTLE"] = Event::MAN_TELEPORT_CASTLE;
-	_event_mappings["SILVER_KEY"] = Event::SILVER_KEY;
-	_event_mappings["BRONZE_KEY"] = Event::BRONZE_KEY;
-	_event_mappings["MURPHYS_GHOSTS"] = Event::MURPHYS_GHOSTS;
-	_event_mappings["BEAR_STATUE"] = Event::BEAR_STATUE;
-	_event_mappings["FROG_STATUE"] = Event::FROG_STATUE;
-	_event_mappings["GOLD_KEY"] = Event::GOLD_KEY;
-	_event_mappings["NEED_SILVER_KEY"] = Event::NEED_SILVER_KEY;
-	_event_mappings["NEED_BRONZE_KEY"] = Event::NEED_BRONZE_KEY;
-	_event_mappings["NEED_BEAR_STATUE"] = Event::NEED_BEAR_STATUE;
-
-	_event_mappings["NEED_FROG_STATUE"] = Event::NEED_FROG_STATUE;
-	_event_mappings["PLACARD_PIT_1"] = Event::PLACARD_PIT_1;
-	_event_mappings["PLACARD_PIT_2"] = Event::PLACARD_PIT_2;
-	_event_mappings["PLACARD_PIT_3"] = Event::PLACARD_PIT_3;
-	_event_mappings["TURN_AROUND"] = Event::TURN_AROUND;
-	_event_mappings["TURN_LEFT"] = Event::TURN_LEFT;
-	_event_mappings["TURN_RIGHT"] = Event::TURN_RIGHT;
-	_event_mappings["NEED_BEAR_STATUE_2"] =
-		Enums::Map::Event::NEED_BEAR_STATUE_2;
-	_event_mappings["TESTING_GROUNDS"] = Event::TESTING_GROUNDS;
-	_event_mappings["ALARM_BELLS"] = Event::ALARM_BELLS;
-
-	_event_mappings["TREASURE_REPOSITORY"] = Event::TREASURE_REPOSITORY;
-	_event_mappings["MONSTER_ALLOCATION_CENTRE"] =
-		Event::MONSTER_ALLOCATION_CENTRE;
-	_event_mappings["LARGE_DESK"] = Event::LARGE_DESK;
-	_event_mappings["TREBOR_VOICE"] = Event::TREBOR_VOICE;
-	_event_mappings["SERVICE_ELEVATOR"] = Event::SERVICE_ELEVATOR;
-	_event_mappings["WERDNA_BOAST"] = Event::WERDNA_BOAST;
-	_event_mappings["TURN_BACK"] = Event::TURN_BACK;
-	_event_mappings["WERDNA_SIGN"] = Event::WERDNA_SIGN;
-	_event_mappings["THREE_HUMANOIDS"] = Event::THREE_HUMANOIDS;
-	_event_mappings["GETTING_WARM_1"] = Event::GETTING_WARM_1;
-
-	_event_mappings["GETTING_WARM_2"] = Event::GETTING_WARM_2;
-	_event_mappings["GETTING_WARM_3"] = Event::GETTING_WARM_3;
-	_event_mappings["FIRE_DRAGONS_COMBAT"] = Event::FIRE_DRAGONS_COMBAT;
-	_event_mappings["DEADLY_RING_COMBAT"] = Event::DEADLY_RING_COMBAT;
-	_event_mappings["WERDNA_COMBAT"] = Event::WERDNA_COMBAT;
-	_event_mappings["GUARANTEED_COMBAT"] = Event::GUARANTEED_COMBAT;
-	_event_mappings["NEED_BLUE_RIBBON"] = Event::NEED_BLUE_RIBBON;
 }
 
 auto Sorcery::Level::_load_metadata(const Json::Value note_data) -> bool {
@@ -367,10 +314,7 @@ auto Sorcery::Level::_load_metadata(const Json::Value note_data) -> bool {
 auto Sorcery::Level::_map_event_types(const std::string &string) const
 	-> std::optional<Enums::Map::Event> {
 
-	if (_event_mappings.contains(string))
-		return _event_mappings.at(string);
-
-	return std::nullopt;
+	return find_event(string);
 }
 
 auto Sorcery::Level::_load_markers(const Json::Value row_data) -> bool {
@@ -371,4 +371,10 @@ auto operator<<(std::ostream &out_stream,
 
 	return out_stream << text << std::flush;
 }
-} // namest
\ No newline at end of file
+} // namest
+
+// Only for repeatable runs (see Random::seed)
+auto Sorcery::MonsterType::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
@@ -33,6 +33,7 @@ Sorcery::State::State(System *system)
 
 	_clear();
 	_restart_expedition();
+	_set_log_file();
 }
 
 auto Sorcery::State::reset_shop(ItemStore *itemstore) -> void {
@@ -164,6 +165,7 @@ auto Sorcery::State::_restart_expedition() -> void {
 auto Sorcery::State::set(System *system) -> void {
 
 	_system = system;
+	_set_log_file();
 }
 
 auto Sorcery::State::set_party(std::vector<unsigned int> candidate_party)
@@ -322,7 +324,7 @@ auto Sorcery::State::add_log_message(
 	Enums::Internal::MessageType type = Enums::Internal::MessageType::STANDARD)
 	-> void {
 
-	_log.emplace_back(ConsoleMessage{type, text});
+	_log.add(type, text);
 }
 
 auto Sorcery::State::clear_log_messages() -> void {
@@ -343,18 +345,15 @@ auto Sorcery::State::add_log_dice_roll(const std::string &message,
 		add_log_message(message, Enums::Internal::MessageType::GAME);
 }
 
-auto Sorcery::State::get_log_messages(unsigned int last) const
-	-> std::vector<ConsoleMessage> {
+auto Sorcery::State::get_log() const -> const GameLog & {
 
-	if (last == 0)
-		return _log;
-	else {
-		if (_log.size() < last)
-			last = _log.size();
+	return _log;
+}
 
-		std::vector<ConsoleMessage> results{_log.cend() - last, _log.cend()};
-		return results;
-	}
+// Messages that no longer fit in the log can optionally be kept in a file
+auto Sorcery::State::_set_log_file() -> void {
+
+	_log.set_spill_file(_system->config->get("Debug", LOG_FILE_KEY));
 }
 
 auto Sorcery::State::check_shop_stock(